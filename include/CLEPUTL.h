@@ -402,7 +402,9 @@
  * for example URL support, remote access, character conversion, etc. The
  * handle is given to the callback function. The default implementation don't
  * need any handle, but you can use it for example for the character conversion
- * module, a remote session or something else.
+ * module, a remote session or something else. With the default implementation
+ * the parameter file is not loaded as a whole but read in chunks while parsing,
+ * so the memory required does not depend on the size of the file.
  *
  * To handle passwords and passphrase more secure, you can provide a filename
  * as string (PASSWD=f'filename'), which contains the corresponding string
@@ -830,7 +832,76 @@
 #define CLEP_DEFAULT_CCSID_ASCII     819  // "ISO8859-1" Latin-1
 #define CLEP_DEFAULT_CCSID_EBCDIC    1047 // "IBM-1047"  Open Systems Latin-1
 
-/** Free memory space */
+/**
+ * Allocator used for all dynamic memory of CLP, CLE and the utility functions.
+ * Memory returned by these libraries (e.g. by dmapstr()) must be released with
+ * cle_free() if an allocator is installed, and memory handed over to these libraries
+ * (e.g. the buffer of a TfF2S callback) must be allocated with cle_malloc() or
+ * cle_realloc(). The context pointer is passed to each function.
+ */
+typedef struct CleAlc {
+   void*                         pvAlc;                                 /**< Context of the allocator */
+   void*                         (*pfMalloc)(void* pvAlc, size_t size); /**< Allocates memory like malloc() */
+   void*                         (*pfRealloc)(void* pvAlc, void* ptr, size_t size); /**< Reallocates memory like realloc() */
+   void                          (*pfFree)(void* pvAlc, void* ptr);     /**< Releases memory like free() */
+} TsCleAlc;
+
+/**
+ * Installs an allocator for CLP, CLE and the utility functions. The process-wide
+ * allocator must be installed before any handle is opened. The thread allocator
+ * overrides it for the current thread (if the compiler supports thread local storage), for example to parse into a
+ * request scoped memory pool. Memory must be released with the allocator which was
+ * active at allocation, i.e. a handle must be closed with the same allocator as it
+ * was opened. Symbol tables are not shared between handles (CLP_SYMTAB_SHARED)
+ * while a thread allocator is installed.
+ * @param alc     pointer to the allocator (copied) or NULL to reset to the C library
+ * @param thread  if true the allocator is installed for the current thread else process-wide
+ */
+extern void cle_setalc(const TsCleAlc* alc, const int thread);
+
+/**
+ * Determines the allocator active for the current thread, for example to release memory later
+ * with the allocator which was active at allocation.
+ * @param alc     pointer to the structure filled with the allocator (all NULL for the C library)
+ */
+extern void cle_getalc(TsCleAlc* alc);
+
+/**
+ * Tells if a thread allocator is installed for the current thread.
+ * @return        true if a thread allocator is installed else false
+ */
+extern int cle_thdalc(void);
+
+/**
+ * Allocates memory with the installed allocator (malloc() if none).
+ * @param size    size of the memory
+ * @return        pointer to the memory or NULL
+ */
+extern void* cle_malloc(size_t size);
+
+/**
+ * Allocates zeroed memory with the installed allocator (calloc() if none).
+ * @param num     amount of elements
+ * @param size    size of one element
+ * @return        pointer to the memory or NULL
+ */
+extern void* cle_calloc(size_t num, size_t size);
+
+/**
+ * Reallocates memory with the installed allocator (realloc() if none).
+ * @param ptr     pointer to the memory or NULL
+ * @param size    new size of the memory
+ * @return        pointer to the memory or NULL
+ */
+extern void* cle_realloc(void* ptr, size_t size);
+
+/**
+ * Releases memory with the installed allocator (free() if none).
+ * @param ptr     pointer to the memory or NULL
+ */
+extern void cle_free(void* ptr);
+
+/** Free memory space with free() (the CLP/CLE sources release their memory with cle_free()) */
 static inline void do_save_free(void** x) { if (NULL!=x && NULL != (*x)) { free(*x); (*x) = NULL; } }
 #define SAFE_FREE(x) do_save_free((void**)(&(x)))
 
@@ -1058,6 +1129,18 @@ extern int snprintc(char* buffer,const size_t size,const char* format,...) PRINT
  */
 extern int srprintc(char** buffer,size_t* size,const size_t expansion,const char* format,...) PRINTF_CHECK(4, 5);
 
+/**
+ * Works like srprintc but the current length of the string in the buffer is given and updated, so appending
+ * to a large buffer does not require to determine the length each time.
+ * @param buffer    pointer to pointer to the string buffer (is updated, could be NULL at beginning)
+ * @param size      pointer to size of the string buffer (is updated, could be 0 at beginning)
+ * @param length    pointer to the current length of the string in the buffer (is updated)
+ * @param expansion maximal expected expansion of the format string (size must be fit length+strlen(format)+expansion+1)
+ * @param format    format string
+ * @return          amount of characters printed (0 are mainly a error)
+ */
+extern int srprintl(char** buffer,size_t* size,size_t* length,const size_t expansion,const char* format,...) PRINTF_CHECK(5, 6);
+
 /**
  * Works like snprintc but does reallocation of the buffer (maximal expansion of the format string can be specified).
  * @param buffer    pointer to pointer to the string buffer (is updated, could be NULL at beginning)
@@ -1394,6 +1477,22 @@ extern void chr_ebc(
          char*          ebc,
    const unsigned int   len);
 
+/**
+ * Open a file using the specified filename for reading the content in chunks.
+ * The file is opened in the same way as with file2str, so the error codes and
+ * messages are the same.
+ *
+ * @param hdl is ignored and not used (same as for file2str)
+ * @param filename The path and name of the file to open
+ * @param file A pointer to the file pointer which is set at success
+ * @param errmsg Pointer to a provided buffer for the error message (optional (can be NULL), result is null terminated)
+ * @param msgsiz The size of the buffer for the error message (optional (can be 0))
+ * @return 0 at success else a negative value as error code:
+ *         * -1: invalid arguments
+ *         * -2: fopen() failed
+ */
+extern int file2stm(const void* hdl, const char* filename, FILE** file, char* errmsg, const int msgsiz);
+
 /**
  * Read a file using the specified filename and reads the whole content
  * into the supplied buffer. The buffer is reallocated and bufsize updated,
@@ -1542,6 +1641,44 @@ typedef struct DiaChr {
 
 extern void          init_diachr(TsDiaChr* psDiaChr,const unsigned int uiCcsId);
 
+/**
+ * Get the table of dia-critical characters for a CCSID from a cache (per thread) instead of
+ * initializing it with init_diachr on each use.
+ * @param psDiaChr  pointer to the table to fill (copy of the cached table)
+ * @param uiCcsId   CCSID of the table
+ */
+extern void get_diachr(TsDiaChr* psDiaChr, const unsigned int uiCcsId);
+
+/**
+ * Get the table of dia-critical characters for the CCSID defined in the environment variable
+ * CLP_STRING_CCSID. The CCSID is only determined again if the value of the variable changes.
+ * @param psDiaChr  pointer to the table to fill (copy of the cached table)
+ */
+extern void env_diachr(TsDiaChr* psDiaChr);
+
+/**
+ * Determine the length of the initial part of a string which is not changed by un-escaping
+ * (contains no '&' and no dia-critical character which differs in the current code page).
+ * @param input     pointer to the null-terminated string
+ * @param psDiaChr  pointer to the state of the dia-critical characters (initialized with init_diachr)
+ * @return          amount of bytes which can be used unchanged
+ */
+extern size_t        unEscapeSpn(const char* input, const TsDiaChr* psDiaChr);
+
+/**
+ * Un-escape a chunk of a string as part of special character support in EBCDIC codepages.
+ * The state of the dia-critical characters is kept in psDiaChr (initialized with init_diachr)
+ * across the chunks. If isEnd is FALSE, an escape sequence which could be continued in the next
+ * chunk is not processed and the position of this rest is returned in ppRst.
+ * @param input     pointer to the null-terminated chunk containing the escape sequences
+ * @param output    pointer to the output for un-escaping (could be equal to the input pointer)
+ * @param psDiaChr  pointer to the state of the dia-critical characters
+ * @param isEnd     TRUE if this is the last chunk else FALSE
+ * @param ppRst     pointer to the not processed rest of the chunk (optional (can be NULL))
+ * @return          pointer to the terminating null of the un-escaped output
+ */
+extern char*         unEscapeStm(const char* input, char* output, TsDiaChr* psDiaChr, const int isEnd, const char** ppRst);
+
 #ifdef __EBCDIC__
 
 extern TsDiaChr      gsDiaChr;
@@ -1654,6 +1791,20 @@ static inline int ISDDN(int c)              { return (isalnum(c) || c==C_DLR ||
 /**********************************************************************/
 
 /*! @cond PRIVATE */
+#ifdef __CLEALC__ /* defined by the CLP/CLE sources to route their memory through the allocator */
+#  undef  malloc
+#  define malloc(s)       cle_malloc(s)
+#  undef  calloc
+#  define calloc(n,s)     cle_calloc((n),(s))
+#  undef  realloc
+#  define realloc(p,s)    cle_realloc((p),(s))
+#  undef  free
+#  define free(p)         cle_free(p)
+static inline void do_cle_free(void** x) { if (NULL!=x && NULL != (*x)) { cle_free(*x); (*x) = NULL; } }
+#  undef  SAFE_FREE
+#  define SAFE_FREE(x)    do_cle_free((void**)(&(x)))
+#endif
+
 #ifdef __cplusplus
    }
 #endif
@@ -493,6 +493,11 @@ typedef struct ClpArgument {
  * into the supplied buffer. The buffer is reallocated and buffer size
  * updated, if necessary.
  *
+ * The buffer is given back to CLP/CLE, which reallocate and release it with
+ * cle_realloc() and cle_free() (see cle_setalc()). The callback must allocate
+ * and reallocate the buffer with cle_malloc() and cle_realloc() and not with
+ * the functions of the C library, if an allocator is installed.
+ *
  * @param  [in]     pvGbl Pointer to to the global handle as black box given with CleExecute
  * @param  [in]     pvHdl Pointer to a handle given for this callback
  * @param  [in]     pcFil File name to read
@@ -45,6 +45,9 @@
    #define pcClpAbout            FLCLPABO
    #define pvClpOpen             FLCLPOPN
    #define siClpParsePro         FLCLPRSP
+   #define pvClpSnapPro          FLCLPSNP
+   #define siClpApplyPro         FLCLPAPP
+   #define vdClpFreePro          FLCLPFSN
    #define siClpParseCmd         FLCLPRSC
    #define siClpProperties       FLCLPPRO
    #define siClpSyntax           FLCLPSYN
@@ -53,6 +56,7 @@
    #define siClpPrint            FLCLPPRN
    #define siClpLexemes          FLCLPLEX
    #define siClpGrammar          FLCLPGRM
+   #define siClpConstant         FLCLPCON
    #define vdClpClose            FLCLPCLS
    #define pcClpError            FLCLPERR
 #endif
@@ -247,6 +251,47 @@ extern int siClpParsePro(
    const int                     isChk,
    char**                        ppLst);
 
+/**
+ * @brief Take a snapshot of the properties
+ *
+ * The function captures the properties set in the handle (e.g. by \a siClpParsePro) with path, value,
+ * source and row. The snapshot can be applied to another handle of the same command with \a siClpApplyPro,
+ * to set the same properties without scanning and parsing the property list again. The snapshot is
+ * independent of the handle and must be released with \a vdClpFreePro.
+ *
+ * @param[in]  pvHdl Pointer to the corresponding handle created with \a pvClpOpen
+ *
+ * @return Pointer to the snapshot or NULL if an error occurs (error is printed/provided by the handle)
+ */
+extern void* pvClpSnapPro(
+   void*                         pvHdl);
+
+/**
+ * @brief Apply a snapshot of properties
+ *
+ * The function sets the properties captured with \a pvClpSnapPro in the handle like \a siClpParsePro.
+ * The effort is linear to the number of properties in the snapshot. If an error occurs, the properties
+ * of the handle are rolled back to the state before the call.
+ *
+ * @param[in]  pvHdl Pointer to the corresponding handle created with \a pvClpOpen
+ * @param[in]  pvSnp Pointer to the snapshot created with \a pvClpSnapPro
+ * @param[in]  isChk Boolean to enable (TRUE) or disable (FALSE) validation of the root in property path
+ *
+ * @return signed integer with CLP_OK (0 - nothing applied) or an error code (CLPERR_xxxxxx (<0)) or the amount of applied properties (>0)
+ */
+extern int siClpApplyPro(
+   void*                         pvHdl,
+   const void*                   pvSnp,
+   const int                     isChk);
+
+/**
+ * @brief Free a snapshot of properties
+ *
+ * @param[in]  pvSnp Pointer to the snapshot created with \a pvClpSnapPro (NULL is ignored)
+ */
+extern void vdClpFreePro(
+   void*                         pvSnp);
+
 /**
  * @brief Parse the command line
  *
@@ -501,6 +546,33 @@ extern int siClpGrammar(
    void*                         pvHdl,
    FILE*                         pfOut);
 
+/**
+ * @brief Define an application specific constant
+ *
+ * The function adds a constant keyword which can be used in value expressions like
+ * the predefined constants (NOW, KiB, PI, LCDATE, ...). The keyword must start with
+ * a letter followed by letters, digits or '_' and can not be one of the predefined
+ * constants. If the constant is already defined by the application, the value is
+ * replaced. The keyword and the string are copied. Constants are found with the
+ * case sensitivity of the handle, but two constants can not differ only in case.
+ *
+ * @param[in]  pvHdl Pointer to the corresponding handle created with \a pvClpOpen
+ * @param[in]  pcKyw Keyword of the constant
+ * @param[in]  siTyp Type of the constant (CLPTYP_NUMBER, CLPTYP_FLOATN or CLPTYP_STRING)
+ * @param[in]  siNum Value for a number constant
+ * @param[in]  flNum Value for a floating point constant
+ * @param[in]  pcStr Value for a string constant (null-terminated)
+ *
+ * @return signed integer with CLP_OK(0) or an error code (CLPERR_xxxxxx)
+ */
+extern int siClpConstant(
+   void*                         pvHdl,
+   const char*                   pcKyw,
+   const int                     siTyp,
+   const I64                     siNum,
+   const F64                     flNum,
+   const char*                   pcStr);
+
 /**
  * @brief Close the command line parser
  *
@@ -521,6 +593,28 @@ extern void vdClpClose(
    void*                         pvHdl,
    const int                     siMtd);
 
+/**
+ * @brief Close the command line parser and transfer the dynamic memory in one block
+ *
+ * The function works like \a vdClpClose with method CLPCLS_MTD_EXC, but all dynamic
+ * allocated buffers referenced by the CLP structure are copied into one contiguous
+ * block and the pointers in the CLP structure are rewritten to point into this block.
+ * The block is owned by the caller and can be released with one free (cle_free() if
+ * an allocator is installed). Pointers to nested buffers inside the block contain
+ * absolute addresses. Memory allocated by the application with \a pvClpAlloc and not
+ * referenced by the CLP structure is not moved and must be released by the application
+ * like with method EXC. If the block cannot be allocated, the function works like
+ * method EXC.
+ *
+ * @param[in]  pvHdl Pointer to the corresponding handle created with \a pvClpOpen
+ * @param[out] pzBlk Pointer to a variable for the size of the block (can be NULL)
+ *
+ * @return Pointer to the block or NULL if no dynamic memory is referenced or the allocation failed
+ */
+extern void* pvClpCloseBlk(
+   void*                         pvHdl,
+   size_t*                       pzBlk);
+
 /**
  * @brief Allocate memory in CLP structure
  *
@@ -93,6 +93,7 @@ static inline int flzjsy(const char* pcDat, const int* piSln, char* pcVal, int*
    }
 #endif
 
+#define __CLEALC__
 #include "CLEPUTL.h"
 
 #ifndef realloc_nowarn
@@ -103,6 +104,15 @@ static inline int flzjsy(const char* pcDat, const int* piSln, char* pcVal, int*
 #  define fopen_nowarn        fopen
 #endif
 
+/* Storage class for thread local variables (not defined if the compiler does not support it) */
+#if defined(__GNUC__) || defined(__clang__) || defined(__IBMC__)
+#  define CLETLS                 __thread
+#elif defined(_MSC_VER)
+#  define CLETLS                 __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__>=201112L && !defined(__STDC_NO_THREADS__)
+#  define CLETLS                 _Thread_local
+#endif
+
 #ifdef __ZOS__
    static inline const char* filemode(const char* mode) {
       if(mode!=NULL) {
@@ -889,6 +899,112 @@ extern void init_diachr(TsDiaChr* psDiaChr,const unsigned int uiCcsId) {
    psDiaChr->idt[2]=psDiaChr->vbr[0];
 }
 
+/* The tables of dia-critical characters are cached per thread and keyed by the CCSID. The mapping of the
+ * environment variable CLP_STRING_CCSID is only determined again if the value of the variable changes.
+ * If the local code page changes (init_char()), the generation is incremented and all caches are reset,
+ * because the default tables on EBCDIC systems depend on the local code page. The tables are copied to
+ * the caller. Without thread local storage (CLETLS) or an atomic generation counter the cache is not used
+ * and the tables are initialized on each call.*/
+#if defined(__GNUC__) || defined(__clang__)
+#  define DIAGEN_GET()           __atomic_load_n(&guiDiaGen,__ATOMIC_ACQUIRE)
+#  define DIAGEN_INC()           __atomic_add_fetch(&guiDiaGen,1,__ATOMIC_ACQ_REL)
+static unsigned int              guiDiaGen=0;
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__>=201112L && !defined(__STDC_NO_ATOMICS__)
+#  include <stdatomic.h>
+#  define DIAGEN_GET()           atomic_load(&guiDiaGen)
+#  define DIAGEN_INC()           atomic_fetch_add(&guiDiaGen,1)
+static atomic_uint               guiDiaGen=0;
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define DIAGEN_GET()           ((unsigned int)_InterlockedOr(&guiDiaGen,0))
+#  define DIAGEN_INC()           _InterlockedIncrement(&guiDiaGen)
+static volatile long             guiDiaGen=0;
+#endif
+
+#if defined(CLETLS) && defined(DIAGEN_GET) /* without an atomic generation counter the cache is not used */
+#  define DIACCH
+#endif
+
+#ifdef DIACCH
+#define DIACCH_CNT               8
+#define DIACCH_ENV               32
+
+typedef struct DiaCch {
+   unsigned int                  uiGen;
+   int                           siCnt;
+   int                           siNxt;
+   unsigned int                  auCcs[DIACCH_CNT];
+   TsDiaChr                      asDia[DIACCH_CNT];
+   int                           isEnv;
+   unsigned int                  uiEnv;
+   char                          acEnv[DIACCH_ENV];
+} TsDiaCch;
+
+static CLETLS TsDiaCch           gsDiaCch;
+
+static TsDiaChr* psDiaCchFnd(const unsigned int uiCcsId) {
+   unsigned int                  uiGen=DIAGEN_GET();
+   int                           i;
+   if (gsDiaCch.uiGen!=uiGen) {
+      gsDiaCch.uiGen=uiGen;
+      gsDiaCch.siCnt=0;
+      gsDiaCch.siNxt=0;
+      gsDiaCch.isEnv=FALSE;
+   }
+   for (i=0;i<gsDiaCch.siCnt;i++) {
+      if (gsDiaCch.auCcs[i]==uiCcsId) return(&gsDiaCch.asDia[i]);
+   }
+   return(NULL);
+}
+
+static TsDiaChr* psDiaCchAdd(const unsigned int uiCcsId) {
+   int                           i=gsDiaCch.siNxt;
+   gsDiaCch.siNxt=(i+1)%DIACCH_CNT;
+   if (gsDiaCch.siCnt<DIACCH_CNT) gsDiaCch.siCnt++;
+   gsDiaCch.auCcs[i]=uiCcsId;
+   return(&gsDiaCch.asDia[i]);
+}
+#endif
+
+extern void get_diachr(TsDiaChr* psDiaChr, const unsigned int uiCcsId) {
+#ifdef DIACCH
+   TsDiaChr*                     psCch;
+#ifdef __EBCDIC__
+   if (gsDiaChr.exc[0]==0) init_char(gsDiaChr.exc); /* the default table depends on the local code page */
+#endif
+   psCch=psDiaCchFnd(uiCcsId);
+   if (psCch==NULL) {
+      psCch=psDiaCchAdd(uiCcsId);
+      init_diachr(psCch,uiCcsId);
+   }
+   *psDiaChr=*psCch;
+#else
+   init_diachr(psDiaChr,uiCcsId);
+#endif
+}
+
+extern void env_diachr(TsDiaChr* psDiaChr) {
+   const char*                   pcEnv=GETENV("CLP_STRING_CCSID");
+   unsigned int                  uiCcsId;
+   if (pcEnv==NULL) pcEnv="";
+#ifdef DIACCH
+   psDiaCchFnd(0); /* reset the cache if the generation is changed */
+   if (gsDiaCch.isEnv && strcmp(gsDiaCch.acEnv,pcEnv)==0) {
+      uiCcsId=gsDiaCch.uiEnv;
+   } else {
+      uiCcsId=mapcdstr(pcEnv);
+      gsDiaCch.isEnv=(strlen(pcEnv)<sizeof(gsDiaCch.acEnv));
+      if (gsDiaCch.isEnv) {
+         strcpy(gsDiaCch.acEnv,pcEnv);
+         gsDiaCch.uiEnv=uiCcsId;
+      }
+   }
+#else
+   uiCcsId=mapcdstr(pcEnv);
+#endif
+   get_diachr(psDiaChr,uiCcsId);
+}
+
 #ifdef __EBCDIC__
 
 TsDiaChr gsDiaChr={{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},
@@ -897,9 +1013,29 @@ TsDiaChr gsDiaChr={{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},
                    {0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}};
 
 extern char init_char(const char* p) {
+   static unsigned int uiLoc=0;
    unsigned int uiCcsId=localccsid();
-   printd("Initialize gsDiaChr structure with CCSID %u\n",uiCcsId);
-   init_diachr(&gsDiaChr,uiCcsId);
+#ifdef DIACCH
+   TsDiaChr*    psDiaChr;
+   if (uiCcsId!=uiLoc) {
+      uiLoc=uiCcsId;
+      DIAGEN_INC();
+   }
+   psDiaChr=psDiaCchFnd(uiCcsId);
+   if (psDiaChr!=NULL) {
+      gsDiaChr=*psDiaChr;
+   } else {
+      printd("Initialize gsDiaChr structure with CCSID %u\n",uiCcsId);
+      init_diachr(&gsDiaChr,uiCcsId);
+      *psDiaCchAdd(uiCcsId)=gsDiaChr;
+   }
+#else
+   if (uiCcsId!=uiLoc || gsDiaChr.exc[0]==0) {
+      uiLoc=uiCcsId;
+      printd("Initialize gsDiaChr structure with CCSID %u\n",uiCcsId);
+      init_diachr(&gsDiaChr,uiCcsId);
+   }
+#endif
    return(p[0]);
 }
 
@@ -1322,15 +1458,120 @@ extern void secure_memset(void *ptr,size_t len)
     memset_func(ptr,0,len);
 }
 
-extern char* unEscape(const char* input, char* output)
+static TsCleAlc                  gsCleAlc={NULL,NULL,NULL,NULL};
+#ifdef CLETLS
+static CLETLS TsCleAlc           gsCleThd={NULL,NULL,NULL,NULL};
+#  define CLEALC()               ((gsCleThd.pfMalloc!=NULL)?&gsCleThd:((gsCleAlc.pfMalloc!=NULL)?&gsCleAlc:NULL))
+#else
+#  define CLEALC()               ((gsCleAlc.pfMalloc!=NULL)?&gsCleAlc:NULL)
+#endif
+
+extern void cle_setalc(const TsCleAlc* alc, const int thread)
+{
+   TsCleAlc* psAlc=&gsCleAlc;
+#ifdef CLETLS
+   if (thread) psAlc=&gsCleThd;
+#else
+   (void)thread;
+#endif
+   if (alc!=NULL && alc->pfMalloc!=NULL && alc->pfRealloc!=NULL && alc->pfFree!=NULL) {
+      *psAlc=*alc;
+   } else {
+      memset(psAlc,0,sizeof(*psAlc));
+   }
+}
+
+extern void cle_getalc(TsCleAlc* alc)
+{
+   const TsCleAlc* psAlc=CLEALC();
+   if (psAlc!=NULL) {
+      *alc=*psAlc;
+   } else {
+      memset(alc,0,sizeof(*alc));
+   }
+}
+
+extern int cle_thdalc(void)
+{
+#ifdef CLETLS
+   return(gsCleThd.pfMalloc!=NULL);
+#else
+   return(FALSE);
+#endif
+}
+
+extern void* cle_malloc(size_t size)
+{
+   const TsCleAlc* psAlc=CLEALC();
+   return((psAlc!=NULL)?psAlc->pfMalloc(psAlc->pvAlc,size):(malloc)(size));
+}
+
+extern void* cle_calloc(size_t num, size_t size)
+{
+   const TsCleAlc* psAlc=CLEALC();
+   if (psAlc!=NULL) {
+      void* ptr;
+      if (size && num>((size_t)-1)/size) return(NULL);
+      ptr=psAlc->pfMalloc(psAlc->pvAlc,num*size);
+      if (ptr!=NULL) memset(ptr,0,num*size);
+      return(ptr);
+   }
+   return((calloc)(num,size));
+}
+
+extern void* cle_realloc(void* ptr, size_t size)
+{
+   const TsCleAlc* psAlc=CLEALC();
+   return((psAlc!=NULL)?psAlc->pfRealloc(psAlc->pvAlc,ptr,size):(realloc)(ptr,size));
+}
+
+extern void cle_free(void* ptr)
+{
+   const TsCleAlc* psAlc=CLEALC();
+   if (psAlc!=NULL) {
+      psAlc->pfFree(psAlc->pvAlc,ptr);
+   } else {
+      (free)(ptr);
+   }
+}
+
+extern size_t unEscapeSpn(const char* input, const TsDiaChr* psDiaChr)
+{
+   char                          acSet[16];
+   int                           n=0;
+   acSet[n++]='&';
+   if (psDiaChr->exc[0]!=C_EXC && psDiaChr->exc[0]) { acSet[n++]=psDiaChr->exc[0]; }
+   if (psDiaChr->hsh[0]!=C_HSH && psDiaChr->hsh[0]) { acSet[n++]=psDiaChr->hsh[0]; }
+   if (psDiaChr->dlr[0]!=C_DLR && psDiaChr->dlr[0]) { acSet[n++]=psDiaChr->dlr[0]; }
+   if (psDiaChr->ats[0]!=C_ATS && psDiaChr->ats[0]) { acSet[n++]=psDiaChr->ats[0]; }
+   if (psDiaChr->sbo[0]!=C_SBO && psDiaChr->sbo[0]) { acSet[n++]=psDiaChr->sbo[0]; }
+   if (psDiaChr->bsl[0]!=C_BSL && psDiaChr->bsl[0]) { acSet[n++]=psDiaChr->bsl[0]; }
+   if (psDiaChr->sbc[0]!=C_SBC && psDiaChr->sbc[0]) { acSet[n++]=psDiaChr->sbc[0]; }
+   if (psDiaChr->crt[0]!=C_CRT && psDiaChr->crt[0]) { acSet[n++]=psDiaChr->crt[0]; }
+   if (psDiaChr->grv[0]!=C_GRV && psDiaChr->grv[0]) { acSet[n++]=psDiaChr->grv[0]; }
+   if (psDiaChr->cbo[0]!=C_CBO && psDiaChr->cbo[0]) { acSet[n++]=psDiaChr->cbo[0]; }
+   if (psDiaChr->vbr[0]!=C_VBR && psDiaChr->vbr[0]) { acSet[n++]=psDiaChr->vbr[0]; }
+   if (psDiaChr->cbc[0]!=C_CBC && psDiaChr->cbc[0]) { acSet[n++]=psDiaChr->cbc[0]; }
+   if (psDiaChr->tld[0]!=C_TLD && psDiaChr->tld[0]) { acSet[n++]=psDiaChr->tld[0]; }
+   acSet[n]=EOS;
+   return(strcspn(input,acSet));
+}
+
+extern char* unEscapeStm(const char* input, char* output, TsDiaChr* psDiaChr, const int isEnd, const char** ppRst)
 {
    const char*                   i=input;
    char*                         o=output;
-   TsDiaChr                      stDiaChr;
-   init_diachr(&stDiaChr,mapcdstr(GETENV("CLP_STRING_CCSID")));
-   while(i[0]) {
-      if (i[0]=='&') {
-         if (i[1]=='&') {
+   int                           isStp=FALSE;
+   size_t                        n;
+   while(i[0] && !isStp) {
+      n=unEscapeSpn(i,psDiaChr);
+      if (n) {
+         if (o!=i) { memmove(o,i,n); }
+         i+=n; o+=n;
+      } else if (i[0]=='&') {
+         if (!isEnd && (i[1]==EOS || i[2]==EOS || i[3]==EOS || i[4]==EOS || i[5]==EOS)) {
+            isStp=TRUE;
+         } else if (i[1]=='&') {
             if ((toupper(i[2])=='E' && toupper(i[3])=='X' && toupper(i[4])=='C' && i[5]==';') ||
                 (toupper(i[2])=='H' && toupper(i[3])=='S' && toupper(i[4])=='H' && i[5]==';') ||
                 (toupper(i[2])=='D' && toupper(i[3])=='L' && toupper(i[4])=='R' && i[5]==';') ||
@@ -1355,7 +1596,9 @@ extern char* unEscape(const char* input, char* output)
                if (l==ULONG_MAX && errno==ERANGE) {
                   ;//CPPCHECK
                }
-               if (x[0]==';') {
+               if (!isEnd && x[0]==EOS) {
+                  isStp=TRUE;
+               } else if (x[0]==';') {
                   o[0]='&';
                   i+=2; o++;
                } else {
@@ -1428,10 +1671,13 @@ extern char* unEscape(const char* input, char* output)
             if (uiCcsId==ULONG_MAX && errno==ERANGE) {
                ;//CPPCHECK
             }
-            init_diachr(&stDiaChr,uiCcsId);
-            if (x[0]==';') {
+            if (!isEnd && x[0]==EOS) {
+               isStp=TRUE;
+            } else if (x[0]==';') {
+               get_diachr(psDiaChr,uiCcsId);
                i=x+1;
             } else {
+               get_diachr(psDiaChr,uiCcsId);
                o[0]=i[0];
                i++; o++;
             }
@@ -1439,43 +1685,43 @@ extern char* unEscape(const char* input, char* output)
             o[0]=i[0];
             i++; o++;
          }
-      } else if (i[0]==stDiaChr.exc[0]) {
+      } else if (i[0]==psDiaChr->exc[0]) {
          o[0]=C_EXC;
          i++; o++;
-      } else if (i[0]==stDiaChr.hsh[0]) {
+      } else if (i[0]==psDiaChr->hsh[0]) {
          o[0]=C_HSH;
          i++; o++;
-      } else if (i[0]==stDiaChr.dlr[0]) {
+      } else if (i[0]==psDiaChr->dlr[0]) {
          o[0]=C_DLR;
          i++; o++;
-      } else if (i[0]==stDiaChr.ats[0]) {
+      } else if (i[0]==psDiaChr->ats[0]) {
          o[0]=C_ATS;
          i++; o++;
-      } else if (i[0]==stDiaChr.sbo[0]) {
+      } else if (i[0]==psDiaChr->sbo[0]) {
          o[0]=C_SBO;
          i++; o++;
-      } else if (i[0]==stDiaChr.bsl[0]) {
+      } else if (i[0]==psDiaChr->bsl[0]) {
          o[0]=C_BSL;
          i++; o++;
-      } else if (i[0]==stDiaChr.sbc[0]) {
+      } else if (i[0]==psDiaChr->sbc[0]) {
          o[0]=C_SBC;
          i++; o++;
-      } else if (i[0]==stDiaChr.crt[0]) {
+      } else if (i[0]==psDiaChr->crt[0]) {
          o[0]=C_CRT;
          i++; o++;
-      } else if (i[0]==stDiaChr.grv[0]) {
+      } else if (i[0]==psDiaChr->grv[0]) {
          o[0]=C_GRV;
          i++; o++;
-      } else if (i[0]==stDiaChr.cbo[0]) {
+      } else if (i[0]==psDiaChr->cbo[0]) {
          o[0]=C_CBO;
          i++; o++;
-      } else if (i[0]==stDiaChr.vbr[0]) {
+      } else if (i[0]==psDiaChr->vbr[0]) {
          o[0]=C_VBR;
          i++; o++;
-      } else if (i[0]==stDiaChr.cbc[0]) {
+      } else if (i[0]==psDiaChr->cbc[0]) {
          o[0]=C_CBC;
          i++; o++;
-      } else if (i[0]==stDiaChr.tld[0]) {
+      } else if (i[0]==psDiaChr->tld[0]) {
          o[0]=C_TLD;
          i++; o++;
       } else {
@@ -1484,6 +1730,22 @@ extern char* unEscape(const char* input, char* output)
       }
    }
    o[0]=EOS;
+   if (ppRst!=NULL) { *ppRst=i; }
+   return(o);
+}
+
+extern char* unEscape(const char* input, char* output)
+{
+   TsDiaChr                      stDiaChr;
+   size_t                        n;
+   env_diachr(&stDiaChr);
+   n=unEscapeSpn(input,&stDiaChr);
+   if (output!=input) { memcpy(output,input,n); }
+   if (input[n]) {
+      unEscapeStm(input+n,output+n,&stDiaChr,TRUE,NULL);
+   } else {
+      output[n]=EOS;
+   }
    return(output);
 }
 
@@ -3173,11 +3435,9 @@ extern int snprintc(char* buffer,size_t size,const char* format,...)
    return (h);
 }
 
-extern int srprintc(char** buffer,size_t* size,const size_t expansion,const char* format,...)
+static int vsrprintl(char** buffer,size_t* size,const size_t h,const size_t expansion,const char* format,va_list argv)
 {
-   va_list  argv;
    int      r;
-   size_t   h=(*buffer!=NULL)?strlen(*buffer):0;
    size_t   l=strlen(format);
    size_t   s=h+l+expansion+1;
    if (s < h || s<l || s < expansion || s<1) { // overflow
@@ -3190,12 +3450,33 @@ extern int srprintc(char** buffer,size_t* size,const size_t expansion,const char
       (*buffer)=b;
       (*size)=s;
    }
-   va_start(argv, format);
    r = vsnprintf((*buffer)+h, (*size)-h, format, argv);
-   va_end(argv);
    return(r<0?r:h+r);
 }
 
+extern int srprintc(char** buffer,size_t* size,const size_t expansion,const char* format,...)
+{
+   va_list  argv;
+   int      r;
+   va_start(argv, format);
+   r = vsrprintl(buffer,size,(*buffer!=NULL)?strlen(*buffer):0,expansion,format,argv);
+   va_end(argv);
+   return(r);
+}
+
+extern int srprintl(char** buffer,size_t* size,size_t* length,const size_t expansion,const char* format,...)
+{
+   va_list  argv;
+   int      r;
+   va_start(argv, format);
+   r = vsrprintl(buffer,size,(*buffer!=NULL)?*length:0,expansion,format,argv);
+   va_end(argv);
+   if (r>0) {
+      (*length)=((size_t)r<(*size))?(size_t)r:(*size)-1;
+   }
+   return(r);
+}
+
 extern int srprintf(char** buffer,size_t* size,const size_t expansion,const char* format,...)
 {
    va_list  argv;
@@ -3218,20 +3499,83 @@ extern int srprintf(char** buffer,size_t* size,const size_t expansion,const char
    return(r);
 }
 
+/* The hex conversion uses a table of the 256 byte values as two hex digits and a table with the value+1 of each
+ * hex digit in the character set of the platform (0 for no hex digit). With SSE2 (x86) blocks of 16 bytes are
+ * converted at once. A block of hex digits with an invalid character is converted by the table loop, so the
+ * count of bytes converted in front of the invalid character is returned like before.*/
+static const char gacHexTab[513]=
+   "000102030405060708090A0B0C0D0E0F"
+   "101112131415161718191A1B1C1D1E1F"
+   "202122232425262728292A2B2C2D2E2F"
+   "303132333435363738393A3B3C3D3E3F"
+   "404142434445464748494A4B4C4D4E4F"
+   "505152535455565758595A5B5C5D5E5F"
+   "606162636465666768696A6B6C6D6E6F"
+   "707172737475767778797A7B7C7D7E7F"
+   "808182838485868788898A8B8C8D8E8F"
+   "909192939495969798999A9B9C9D9E9F"
+   "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+   "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+   "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+   "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+   "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+   "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+static const unsigned char gauHexVal[256]={
+   ['0']=0x01,['1']=0x02,['2']=0x03,['3']=0x04,['4']=0x05,['5']=0x06,['6']=0x07,['7']=0x08,['8']=0x09,['9']=0x0A,
+   ['A']=0x0B,['B']=0x0C,['C']=0x0D,['D']=0x0E,['E']=0x0F,['F']=0x10,
+   ['a']=0x0B,['b']=0x0C,['c']=0x0D,['d']=0x0E,['e']=0x0F,['f']=0x10};
+
+#if defined(__SSE2__) && defined(__GNUC__) && !defined(__EBCDIC__) && !defined(__CLPNOSIMD__)
+#  include <emmintrin.h>
+#  define __CLESIMD__
+
+static inline __m128i vcHexChr(const __m128i n) {
+   const __m128i                 gt9=_mm_cmpgt_epi8(n,_mm_set1_epi8(9));
+   return(_mm_add_epi8(_mm_add_epi8(n,_mm_set1_epi8('0')),_mm_and_si128(gt9,_mm_set1_epi8('A'-'0'-10))));
+}
+
+static inline int isHexVal(const __m128i c, __m128i* v) {
+   const __m128i                 d=_mm_sub_epi8(c,_mm_set1_epi8('0'));
+   const __m128i                 l=_mm_sub_epi8(_mm_or_si128(c,_mm_set1_epi8(0x20)),_mm_set1_epi8('a'));
+   const __m128i                 isD=_mm_cmpeq_epi8(_mm_min_epu8(d,_mm_set1_epi8(9)),d);
+   const __m128i                 isL=_mm_cmpeq_epi8(_mm_min_epu8(l,_mm_set1_epi8(5)),l);
+   *v=_mm_or_si128(_mm_and_si128(isD,d),_mm_and_si128(isL,_mm_add_epi8(l,_mm_set1_epi8(10))));
+   return(_mm_movemask_epi8(_mm_or_si128(isD,isL))==0xFFFF);
+}
+
+static inline unsigned int uiChrCpy(const char* src, char* dst, const unsigned int len) {
+   unsigned int                  i;
+   for (i=0;i+16<=len;i+=16) {
+      const __m128i              c=_mm_loadu_si128((const __m128i*)(src+i));
+      const __m128i              p=_mm_and_si128(_mm_cmpgt_epi8(c,_mm_set1_epi8(0x1F)),_mm_cmplt_epi8(c,_mm_set1_epi8(0x7F)));
+      const __m128i              n=_mm_or_si128(_mm_cmpeq_epi8(c,_mm_set1_epi8(0x0A)),_mm_cmpeq_epi8(c,_mm_set1_epi8(0x0D)));
+      if (_mm_movemask_epi8(_mm_or_si128(p,n))!=0xFFFF) break;
+      _mm_storeu_si128((__m128i*)(dst+i),c);
+   }
+   return(i);
+}
+#endif
+
 extern unsigned int bin2hex(
    const unsigned char* bin,
          char*          hex,
    const unsigned int   len)
 {
-   unsigned int         i;
-   const unsigned char  m[16]={'0','1','2','3',
-                               '4','5','6','7',
-                               '8','9','A','B',
-                               'C','D','E','F'};
-   for(i=0;i<len;i++)
+   unsigned int         i=0;
+#ifdef __CLESIMD__
+   const __m128i        m=_mm_set1_epi8(0x0F);
+   for (;i+16<=len;i+=16) {
+      const __m128i     b=_mm_loadu_si128((const __m128i*)(bin+i));
+      const __m128i     h=vcHexChr(_mm_and_si128(_mm_srli_epi16(b,4),m));
+      const __m128i     l=vcHexChr(_mm_and_si128(b,m));
+      _mm_storeu_si128((__m128i*)(hex+2*i),_mm_unpacklo_epi8(h,l));
+      _mm_storeu_si128((__m128i*)(hex+2*i+16),_mm_unpackhi_epi8(h,l));
+   }
+#endif
+   for(;i<len;i++)
    {
-      hex[i*2+0]=m[((bin[i])>>4)&0x0F];
-      hex[i*2+1]=m[((bin[i])>>0)&0x0F];
+      memcpy(hex+2*i,gacHexTab+2*bin[i],2);
    }
    return(2*i);
 }
@@ -3241,54 +3585,153 @@ extern unsigned int hex2bin(
          unsigned char* bin,
    const unsigned int   len)
 {
-   unsigned int         i,j;
+   unsigned int         j=0;
    unsigned char        h1,h2;
-
-   for (j=i=0;i<len-1;i+=2,j++)
+#ifdef __CLESIMD__
+   const __m128i        m=_mm_set1_epi16(0x00FF);
+   for (;2*j+32<=len;j+=16) {
+      __m128i           v1,v2;
+      if (!isHexVal(_mm_loadu_si128((const __m128i*)(hex+2*j)),&v1) ||
+          !isHexVal(_mm_loadu_si128((const __m128i*)(hex+2*j+16)),&v2)) {
+         break;
+      }
+      v1=_mm_or_si128(_mm_slli_epi16(_mm_and_si128(v1,m),4),_mm_srli_epi16(v1,8));
+      v2=_mm_or_si128(_mm_slli_epi16(_mm_and_si128(v2,m),4),_mm_srli_epi16(v2,8));
+      _mm_storeu_si128((__m128i*)(bin+j),_mm_packus_epi16(v1,v2));
+   }
+#endif
+   for (;2*j+1<len;j++)
    {
-      switch (toupper(hex[i+0]))
-      {
-         case '0': h1=0x00; break;
-         case '1': h1=0x01; break;
-         case '2': h1=0x02; break;
-         case '3': h1=0x03; break;
-         case '4': h1=0x04; break;
-         case '5': h1=0x05; break;
-         case '6': h1=0x06; break;
-         case '7': h1=0x07; break;
-         case '8': h1=0x08; break;
-         case '9': h1=0x09; break;
-         case 'A': h1=0x0A; break;
-         case 'B': h1=0x0B; break;
-         case 'C': h1=0x0C; break;
-         case 'D': h1=0x0D; break;
-         case 'E': h1=0x0E; break;
-         case 'F': h1=0x0F; break;
-         default: return(j);
+      h1=gauHexVal[(unsigned char)hex[2*j+0]];
+      if (h1==0) return(j);
+      h2=gauHexVal[(unsigned char)hex[2*j+1]];
+      if (h2==0) return(j);
+      bin[j]=(((h1-1)<<4)&0xF0)|((h2-1)&0x0F);
+   }
+   return(j);
+}
+
+/* The character set converters use 256 byte translation tables. The tables from and to the local character
+ * set depend on the dia-critical characters of the local code page (EBCDIC), they are built per thread at
+ * the first use and again if one of these characters changes. In the tables of the checking variants a value
+ * of 0 marks a character which cannot be converted (no valid character is converted to 0).*/
+static const char gacAscChr[256]={
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'\n',0x0,0x0,'\r',0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   ' ','!','\"','#','$','%','&','\'','(',')','*','+',',','-','.','/',   /*nodiac*/
+   '0','1','2','3','4','5','6','7','8','9',':',';','<','=','>','?',     /*nodiac*/
+   '@','A','B','C','D','E','F','G','H','I','J','K','L','M','N','O',     /*nodiac*/
+   'P','Q','R','S','T','U','V','W','X','Y','Z','[','\\',']','^','_',    /*nodiac*/
+   '`','a','b','c','d','e','f','g','h','i','j','k','l','m','n','o',     /*nodiac*/
+   'p','q','r','s','t','u','v','w','x','y','z','{','|','}','~',0x0,     /*nodiac*/
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+
+static const char gacEbcChr[256]={
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'\r',0x0, 0x0,
+   0x0,0x0,0x0,0x0,0x0,'\n',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0, 0x0, 0x0,
+   0x0,0x0,0x0,0x0,0x0,'\n',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0, 0x0, 0x0,
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0, 0x0, 0x0,
+   ' ',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'.','<','(', '+', '|',   /*nodiac*/
+   '&',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'!','$','*',')', ';', '^',   /*nodiac*/
+   '-','/',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,',','%','_', '>', '\?',  /*nodiac*/
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'`',':','#','@','\'','=','\"',   /*nodiac*/
+   0x0,'a','b','c','d','e','f','g','h','i',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
+   0x0,'j','k','l','m','n','o','p','q','r',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
+   0x0,'~','s','t','u','v','w','x','y','z',0x0,0x0,0x0,'[', 0x0, 0x0,   /*nodiac*/
+   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,']', 0x0, 0x0,   /*nodiac*/
+   '{','A','B','C','D','E','F','G','H','I',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
+   '}','J','K','L','M','N','O','P','Q','R',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
+   '\\',0x0,'S','T','U','V','W','X','Y','Z',0x0,0x0,0x0,0x0, 0x0, 0x0,  /*nodiac*/
+   '0','1','2','3','4','5','6','7','8','9',0x0,0x0,0x0,0x0, 0x0, 0x0};  /*nodiac*/
+
+#define CHRTAB_DIA               13
+
+typedef struct ChrTab {
+   char                          acDia[CHRTAB_DIA];
+   char                          acChrAsc[256];
+   char                          acChrAsu[256];
+   char                          acChrEbc[256];
+   char                          acChrEbu[256];
+   char                          acAscChu[256];
+   char                          acEbcChr[256];
+   char                          acEbcChu[256];
+} TsChrTab;
+
+static const TsChrTab* psChrTab(TsChrTab* psTab) {
+   static const char             acDiaLit[CHRTAB_DIA]={'!','#','$','@','[','\\',']','^','`','{','|','}','~'}; /*nodiac*/
+   static const unsigned char    auDiaAsc[CHRTAB_DIA]={0x21,0x23,0x24,0x40,0x5B,0x5C,0x5D,0x5E,0x60,0x7B,0x7C,0x7D,0x7E};
+   static const unsigned char    auDiaEbc[CHRTAB_DIA]={0x5A,0x7B,0x5B,0x7C,0xAD,0xE0,0xBD,0x5F,0x79,0xC0,0x4F,0xD0,0xA1};
+   const char                    acDia[CHRTAB_DIA]={C_EXC,C_HSH,C_DLR,C_ATS,C_SBO,C_BSL,C_SBC,C_CRT,C_GRV,C_CBO,C_VBR,C_CBC,C_TLD};
+   const char*                   p;
+   char                          c;
+   int                           i;
+
+   if (psTab->acDia[0]==0x00 || memcmp(psTab->acDia,acDia,CHRTAB_DIA)!=0) {
+      memset(psTab,0,sizeof(TsChrTab));
+      // the dia-critical characters of the local character set (the first one wins like in an else-if chain)
+      for (i=CHRTAB_DIA-1;i>=0;i--) {
+         psTab->acChrAsc[(unsigned char)acDia[i]]=(char)auDiaAsc[i];
+         psTab->acChrEbc[(unsigned char)acDia[i]]=(char)auDiaEbc[i];
       }
-      switch (toupper(hex[i+1]))
-      {
-         case '0': h2=0x00; break;
-         case '1': h2=0x01; break;
-         case '2': h2=0x02; break;
-         case '3': h2=0x03; break;
-         case '4': h2=0x04; break;
-         case '5': h2=0x05; break;
-         case '6': h2=0x06; break;
-         case '7': h2=0x07; break;
-         case '8': h2=0x08; break;
-         case '9': h2=0x09; break;
-         case 'A': h2=0x0A; break;
-         case 'B': h2=0x0B; break;
-         case 'C': h2=0x0C; break;
-         case 'D': h2=0x0D; break;
-         case 'E': h2=0x0E; break;
-         case 'F': h2=0x0F; break;
-         default: return(j);
+      // the other characters have precedence and are the reverse of the tables to the local character set
+      for (i=0;i<256;i++) {
+         c=gacAscChr[i];
+         if (c!=0x00 && memchr(auDiaAsc,i,CHRTAB_DIA)==NULL) psTab->acChrAsc[(unsigned char)c]=(char)i;
+         c=gacEbcChr[i];
+         if (c!=0x00 && memchr(auDiaEbc,i,CHRTAB_DIA)==NULL) psTab->acChrEbc[(unsigned char)c]=(char)i;
+         p=(c!=0x00)?(const char*)memchr(acDiaLit,c,CHRTAB_DIA):NULL;
+         psTab->acEbcChr[i]=(p!=NULL)?acDia[p-acDiaLit]:c;
       }
-      bin[j]=((h1<<4)&0xF0)|((h2<<0)&0x0F);
+      for (i=0;i<256;i++) {
+         psTab->acChrAsu[i]=(psTab->acChrAsc[i]!=0x00 || i==0)?psTab->acChrAsc[i]:0x5F;
+         psTab->acChrEbu[i]=(psTab->acChrEbc[i]!=0x00 || i==0)?psTab->acChrEbc[i]:0x6D;
+         psTab->acAscChu[i]=(gacAscChr[i]!=0x00)?gacAscChr[i]:'_';
+         psTab->acEbcChu[i]=(psTab->acEbcChr[i]!=0x00)?psTab->acEbcChr[i]:'_';
+      }
+      memcpy(psTab->acDia,acDia,CHRTAB_DIA);
    }
-   return(j);
+   return(psTab);
+}
+
+/* The tables are built once per thread and again only if the dia-critical characters change, without
+ * thread local storage (see CLETLS) they are built on the stack for each call.*/
+#ifdef CLETLS
+static CLETLS TsChrTab           gsChrTab;
+#  define CHRTAB(tab,fld)        const char* tab=psChrTab(&gsChrTab)->fld
+#else
+#  define CHRTAB(tab,fld)        TsChrTab stChrTab; const char* tab=(stChrTab.acDia[0]=0x00,psChrTab(&stChrTab)->fld)
+#endif
+
+/* On ASCII platforms the conversion from and to ASCII does not change new line, carriage return and the printable
+ * characters, the table loop continues behind the blocks of such characters copied by uiChrCpy(). For the
+ * checking variants the count of characters converted in front of the first invalid character is returned.*/
+static inline unsigned int uiChrCnv(
+   const char*          src,
+         char*          dst,
+   const unsigned int   len,
+   const char*          tab,
+   const int            chk,
+   const int            cpy)
+{
+   unsigned int         i=0;
+   unsigned int         e;
+   while (i<len) {
+#ifdef __CLESIMD__
+      if (cpy) i+=uiChrCpy(src+i,dst+i,len-i);
+#endif
+      for (e=(cpy && i+16<len)?i+16:len;i<e;i++) {
+         dst[i]=tab[(unsigned char)src[i]];
+         if (chk && dst[i]==0x00) return(i);
+      }
+   }
+   return(i);
 }
 
 extern unsigned int chr2asc(
@@ -3296,134 +3739,8 @@ extern unsigned int chr2asc(
          char*          asc,
    const unsigned int   len)
 {
-   unsigned int         i;
-   for (i=0;i<len;i++) {
-      switch (chr[i]) {
-         case '\n' : asc[i]=0x0A; break;
-         case '\r' : asc[i]=0x0D; break;
-
-         case ' '  : asc[i]=0x20; break;
-         case '\"' : asc[i]=0x22; break;
-         case '%'  : asc[i]=0x25; break;
-         case '&'  : asc[i]=0x26; break;
-         case '\'' : asc[i]=0x27; break;
-         case '('  : asc[i]=0x28; break;
-         case ')'  : asc[i]=0x29; break;
-         case '*'  : asc[i]=0x2A; break;
-         case '+'  : asc[i]=0x2B; break;
-         case ','  : asc[i]=0x2C; break;
-         case '-'  : asc[i]=0x2D; break;
-         case '.'  : asc[i]=0x2E; break;
-         case '/'  : asc[i]=0x2F; break;
-
-         case '0'  : asc[i]=0x30; break;
-         case '1'  : asc[i]=0x31; break;
-         case '2'  : asc[i]=0x32; break;
-         case '3'  : asc[i]=0x33; break;
-         case '4'  : asc[i]=0x34; break;
-         case '5'  : asc[i]=0x35; break;
-         case '6'  : asc[i]=0x36; break;
-         case '7'  : asc[i]=0x37; break;
-         case '8'  : asc[i]=0x38; break;
-         case '9'  : asc[i]=0x39; break;
-         case ':'  : asc[i]=0x3A; break;
-         case ';'  : asc[i]=0x3B; break;
-         case '<'  : asc[i]=0x3C; break;
-         case '='  : asc[i]=0x3D; break;
-         case '>'  : asc[i]=0x3E; break;
-         case '?'  : asc[i]=0x3F; break;
-
-         case 'A'  : asc[i]=0x41; break;
-         case 'B'  : asc[i]=0x42; break;
-         case 'C'  : asc[i]=0x43; break;
-         case 'D'  : asc[i]=0x44; break;
-         case 'E'  : asc[i]=0x45; break;
-         case 'F'  : asc[i]=0x46; break;
-         case 'G'  : asc[i]=0x47; break;
-         case 'H'  : asc[i]=0x48; break;
-         case 'I'  : asc[i]=0x49; break;
-         case 'J'  : asc[i]=0x4A; break;
-         case 'K'  : asc[i]=0x4B; break;
-         case 'L'  : asc[i]=0x4C; break;
-         case 'M'  : asc[i]=0x4D; break;
-         case 'N'  : asc[i]=0x4E; break;
-         case 'O'  : asc[i]=0x4F; break;
-
-         case 'P'  : asc[i]=0x50; break;
-         case 'Q'  : asc[i]=0x51; break;
-         case 'R'  : asc[i]=0x52; break;
-         case 'S'  : asc[i]=0x53; break;
-         case 'T'  : asc[i]=0x54; break;
-         case 'U'  : asc[i]=0x55; break;
-         case 'V'  : asc[i]=0x56; break;
-         case 'W'  : asc[i]=0x57; break;
-         case 'X'  : asc[i]=0x58; break;
-         case 'Y'  : asc[i]=0x59; break;
-         case 'Z'  : asc[i]=0x5A; break;
-         case '_'  : asc[i]=0x5F; break;
-
-         case 'a'  : asc[i]=0x61; break;
-         case 'b'  : asc[i]=0x62; break;
-         case 'c'  : asc[i]=0x63; break;
-         case 'd'  : asc[i]=0x64; break;
-         case 'e'  : asc[i]=0x65; break;
-         case 'f'  : asc[i]=0x66; break;
-         case 'g'  : asc[i]=0x67; break;
-         case 'h'  : asc[i]=0x68; break;
-         case 'i'  : asc[i]=0x69; break;
-         case 'j'  : asc[i]=0x6A; break;
-         case 'k'  : asc[i]=0x6B; break;
-         case 'l'  : asc[i]=0x6C; break;
-         case 'm'  : asc[i]=0x6D; break;
-         case 'n'  : asc[i]=0x6E; break;
-         case 'o'  : asc[i]=0x6F; break;
-
-         case 'p'  : asc[i]=0x70; break;
-         case 'q'  : asc[i]=0x71; break;
-         case 'r'  : asc[i]=0x72; break;
-         case 's'  : asc[i]=0x73; break;
-         case 't'  : asc[i]=0x74; break;
-         case 'u'  : asc[i]=0x75; break;
-         case 'v'  : asc[i]=0x76; break;
-         case 'w'  : asc[i]=0x77; break;
-         case 'x'  : asc[i]=0x78; break;
-         case 'y'  : asc[i]=0x79; break;
-         case 'z'  : asc[i]=0x7A; break;
-
-         default   :
-            if (chr[i]==C_EXC) {
-               asc[i]=0x21;
-            } else if (chr[i]==C_HSH) {
-               asc[i]=0x23;
-            } else if (chr[i]==C_DLR) {
-               asc[i]=0x24;
-            } else if (chr[i]==C_ATS) {
-               asc[i]=0x40;
-            } else if (chr[i]==C_SBO) {
-               asc[i]=0x5B;
-            } else if (chr[i]==C_BSL) {
-               asc[i]=0x5C;
-            } else if (chr[i]==C_SBC) {
-               asc[i]=0x5D;
-            } else if (chr[i]==C_CRT) {
-               asc[i]=0x5E;
-            } else if (chr[i]==C_GRV) {
-               asc[i]=0x60;
-            } else if (chr[i]==C_CBO) {
-               asc[i]=0x7B;
-            } else if (chr[i]==C_VBR) {
-               asc[i]=0x7C;
-            } else if (chr[i]==C_CBC) {
-               asc[i]=0x7D;
-            } else if (chr[i]==C_TLD) {
-               asc[i]=0x7E;
-            } else {
-               asc[i]=0x00;
-               return(i);
-            }
-      }
-   }
-   return(i);
+   CHRTAB(tab,acChrAsc);
+   return(uiChrCnv(chr,asc,len,tab,TRUE,TRUE));
 }
 
 extern unsigned int chr2ebc(
@@ -3431,134 +3748,8 @@ extern unsigned int chr2ebc(
          char*          ebc,
    const unsigned int   len)
 {
-   unsigned int         i;
-   for (i=0;i<len;i++) {
-      switch (chr[i]) {
-         case '\n' : ebc[i]=0x25; break;
-         case '\r' : ebc[i]=0x0D; break;
-
-         case ' '  : ebc[i]=0x40; break;
-         case '\"' : ebc[i]=0x7F; break;
-         case '%'  : ebc[i]=0x6C; break;
-         case '&'  : ebc[i]=0x50; break;
-         case '\'' : ebc[i]=0x7D; break;
-         case '('  : ebc[i]=0x4D; break;
-         case ')'  : ebc[i]=0x5D; break;
-         case '*'  : ebc[i]=0x5C; break;
-         case '+'  : ebc[i]=0x4E; break;
-         case ','  : ebc[i]=0x6B; break;
-         case '-'  : ebc[i]=0x60; break;
-         case '.'  : ebc[i]=0x4B; break;
-         case '/'  : ebc[i]=0x61; break;
-
-         case '0'  : ebc[i]=0xF0; break;
-         case '1'  : ebc[i]=0xF1; break;
-         case '2'  : ebc[i]=0xF2; break;
-         case '3'  : ebc[i]=0xF3; break;
-         case '4'  : ebc[i]=0xF4; break;
-         case '5'  : ebc[i]=0xF5; break;
-         case '6'  : ebc[i]=0xF6; break;
-         case '7'  : ebc[i]=0xF7; break;
-         case '8'  : ebc[i]=0xF8; break;
-         case '9'  : ebc[i]=0xF9; break;
-         case ':'  : ebc[i]=0x7A; break;
-         case ';'  : ebc[i]=0x5E; break;
-         case '<'  : ebc[i]=0x4C; break;
-         case '='  : ebc[i]=0x7E; break;
-         case '>'  : ebc[i]=0x6E; break;
-         case '?'  : ebc[i]=0x6F; break;
-
-         case 'A'  : ebc[i]=0xC1; break;
-         case 'B'  : ebc[i]=0xC2; break;
-         case 'C'  : ebc[i]=0xC3; break;
-         case 'D'  : ebc[i]=0xC4; break;
-         case 'E'  : ebc[i]=0xC5; break;
-         case 'F'  : ebc[i]=0xC6; break;
-         case 'G'  : ebc[i]=0xC7; break;
-         case 'H'  : ebc[i]=0xC8; break;
-         case 'I'  : ebc[i]=0xC9; break;
-         case 'J'  : ebc[i]=0xD1; break;
-         case 'K'  : ebc[i]=0xD2; break;
-         case 'L'  : ebc[i]=0xD3; break;
-         case 'M'  : ebc[i]=0xD4; break;
-         case 'N'  : ebc[i]=0xD5; break;
-         case 'O'  : ebc[i]=0xD6; break;
-
-         case 'P'  : ebc[i]=0xD7; break;
-         case 'Q'  : ebc[i]=0xD8; break;
-         case 'R'  : ebc[i]=0xD9; break;
-         case 'S'  : ebc[i]=0xE2; break;
-         case 'T'  : ebc[i]=0xE3; break;
-         case 'U'  : ebc[i]=0xE4; break;
-         case 'V'  : ebc[i]=0xE5; break;
-         case 'W'  : ebc[i]=0xE6; break;
-         case 'X'  : ebc[i]=0xE7; break;
-         case 'Y'  : ebc[i]=0xE8; break;
-         case 'Z'  : ebc[i]=0xE9; break;
-         case '_'  : ebc[i]=0x6D; break;
-
-         case 'a'  : ebc[i]=0x81; break;
-         case 'b'  : ebc[i]=0x82; break;
-         case 'c'  : ebc[i]=0x83; break;
-         case 'd'  : ebc[i]=0x84; break;
-         case 'e'  : ebc[i]=0x85; break;
-         case 'f'  : ebc[i]=0x86; break;
-         case 'g'  : ebc[i]=0x87; break;
-         case 'h'  : ebc[i]=0x88; break;
-         case 'i'  : ebc[i]=0x89; break;
-         case 'j'  : ebc[i]=0x91; break;
-         case 'k'  : ebc[i]=0x92; break;
-         case 'l'  : ebc[i]=0x93; break;
-         case 'm'  : ebc[i]=0x94; break;
-         case 'n'  : ebc[i]=0x95; break;
-         case 'o'  : ebc[i]=0x96; break;
-
-         case 'p'  : ebc[i]=0x97; break;
-         case 'q'  : ebc[i]=0x98; break;
-         case 'r'  : ebc[i]=0x99; break;
-         case 's'  : ebc[i]=0xA2; break;
-         case 't'  : ebc[i]=0xA3; break;
-         case 'u'  : ebc[i]=0xA4; break;
-         case 'v'  : ebc[i]=0xA5; break;
-         case 'w'  : ebc[i]=0xA6; break;
-         case 'x'  : ebc[i]=0xA7; break;
-         case 'y'  : ebc[i]=0xA8; break;
-         case 'z'  : ebc[i]=0xA9; break;
-
-         default   :
-            if (chr[i]==C_EXC) {
-               ebc[i]=0x5A;
-            } else if (chr[i]==C_HSH) {
-               ebc[i]=0x7B;
-            } else if (chr[i]==C_DLR) {
-               ebc[i]=0x5B;
-            } else if (chr[i]==C_ATS) {
-               ebc[i]=0x7C;
-            } else if (chr[i]==C_SBO) {
-               ebc[i]=0xAD;
-            } else if (chr[i]==C_BSL) {
-               ebc[i]=0xE0;
-            } else if (chr[i]==C_SBC) {
-               ebc[i]=0xBD;
-            } else if (chr[i]==C_CRT) {
-               ebc[i]=0x5F;
-            } else if (chr[i]==C_GRV) {
-               ebc[i]=0x79;
-            } else if (chr[i]==C_CBO) {
-               ebc[i]=0xC0;
-            } else if (chr[i]==C_VBR) {
-               ebc[i]=0x4F;
-            } else if (chr[i]==C_CBC) {
-               ebc[i]=0xD0;
-            } else if (chr[i]==C_TLD) {
-               ebc[i]=0xA1;
-            } else {
-               ebc[i]=0x00;
-               return(i);
-            }
-      }
-   }
-   return(i);
+   CHRTAB(tab,acChrEbc);
+   return(uiChrCnv(chr,ebc,len,tab,TRUE,FALSE));
 }
 
 extern unsigned int asc2chr(
@@ -3566,29 +3757,7 @@ extern unsigned int asc2chr(
          char*          chr,
    const unsigned int   len)
 {
-   unsigned int         i;
-   const char           asc_map[256]={
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'\n',0x0,0x0,'\r',0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   ' ','!','\"','#','$','%','&','\'','(',')','*','+',',','-','.','/',   /*nodiac*/
-   '0','1','2','3','4','5','6','7','8','9',':',';','<','=','>','?',     /*nodiac*/
-   '@','A','B','C','D','E','F','G','H','I','J','K','L','M','N','O',     /*nodiac*/
-   'P','Q','R','S','T','U','V','W','X','Y','Z','[','\\',']','^','_',    /*nodiac*/
-   '`','a','b','c','d','e','f','g','h','i','j','k','l','m','n','o',     /*nodiac*/
-   'p','q','r','s','t','u','v','w','x','y','z','{','|','}','~',0x0,     /*nodiac*/
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
-   for (i=0;i<len;i++) {
-      chr[i]=asc_map[*((unsigned char*)(asc+i))];
-      if (chr[i]==0x0) { return(i); }
-   }
-   return(i);
+   return(uiChrCnv(asc,chr,len,gacAscChr,TRUE,TRUE));
 }
 
 extern void asc_chr(
@@ -3596,27 +3765,8 @@ extern void asc_chr(
          char*          chr,
    const unsigned int   len)
 {
-   unsigned int         i;
-   const char           asc_map[256]={
-   '_','_','_','_','_','_','_','_','_','_','\n','_','_','\r','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   ' ','!','\"','#','$','%','&','\'','(',')','*','+',',','-','.','/',   /*nodiac*/
-   '0','1','2','3','4','5','6','7','8','9',':',';','<','=','>','?',     /*nodiac*/
-   '@','A','B','C','D','E','F','G','H','I','J','K','L','M','N','O',     /*nodiac*/
-   'P','Q','R','S','T','U','V','W','X','Y','Z','[','\\',']','^','_',    /*nodiac*/
-   '`','a','b','c','d','e','f','g','h','i','j','k','l','m','n','o',     /*nodiac*/
-   'p','q','r','s','t','u','v','w','x','y','z','{','|','}','~','_',     /*nodiac*/
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_',
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_','_','_'};
-   for (i=0;i<len;i++) {
-      chr[i]=asc_map[*((unsigned char*)(asc+i))];
-   }
+   CHRTAB(tab,acAscChu);
+   uiChrCnv(asc,chr,len,tab,FALSE,TRUE);
 }
 
 extern void chr_asc(
@@ -3624,133 +3774,8 @@ extern void chr_asc(
          char*          asc,
    const unsigned int   len)
 {
-   unsigned int         i;
-   for (i=0;i<len;i++) {
-      switch (chr[i]) {
-         case 0x00 : asc[i]=0x00; break;
-         case '\n' : asc[i]=0x0A; break;
-         case '\r' : asc[i]=0x0D; break;
-
-         case ' '  : asc[i]=0x20; break;
-         case '\"' : asc[i]=0x22; break;
-         case '%'  : asc[i]=0x25; break;
-         case '&'  : asc[i]=0x26; break;
-         case '\'' : asc[i]=0x27; break;
-         case '('  : asc[i]=0x28; break;
-         case ')'  : asc[i]=0x29; break;
-         case '*'  : asc[i]=0x2A; break;
-         case '+'  : asc[i]=0x2B; break;
-         case ','  : asc[i]=0x2C; break;
-         case '-'  : asc[i]=0x2D; break;
-         case '.'  : asc[i]=0x2E; break;
-         case '/'  : asc[i]=0x2F; break;
-
-         case '0'  : asc[i]=0x30; break;
-         case '1'  : asc[i]=0x31; break;
-         case '2'  : asc[i]=0x32; break;
-         case '3'  : asc[i]=0x33; break;
-         case '4'  : asc[i]=0x34; break;
-         case '5'  : asc[i]=0x35; break;
-         case '6'  : asc[i]=0x36; break;
-         case '7'  : asc[i]=0x37; break;
-         case '8'  : asc[i]=0x38; break;
-         case '9'  : asc[i]=0x39; break;
-         case ':'  : asc[i]=0x3A; break;
-         case ';'  : asc[i]=0x3B; break;
-         case '<'  : asc[i]=0x3C; break;
-         case '='  : asc[i]=0x3D; break;
-         case '>'  : asc[i]=0x3E; break;
-         case '?'  : asc[i]=0x3F; break;
-
-         case 'A'  : asc[i]=0x41; break;
-         case 'B'  : asc[i]=0x42; break;
-         case 'C'  : asc[i]=0x43; break;
-         case 'D'  : asc[i]=0x44; break;
-         case 'E'  : asc[i]=0x45; break;
-         case 'F'  : asc[i]=0x46; break;
-         case 'G'  : asc[i]=0x47; break;
-         case 'H'  : asc[i]=0x48; break;
-         case 'I'  : asc[i]=0x49; break;
-         case 'J'  : asc[i]=0x4A; break;
-         case 'K'  : asc[i]=0x4B; break;
-         case 'L'  : asc[i]=0x4C; break;
-         case 'M'  : asc[i]=0x4D; break;
-         case 'N'  : asc[i]=0x4E; break;
-         case 'O'  : asc[i]=0x4F; break;
-
-         case 'P'  : asc[i]=0x50; break;
-         case 'Q'  : asc[i]=0x51; break;
-         case 'R'  : asc[i]=0x52; break;
-         case 'S'  : asc[i]=0x53; break;
-         case 'T'  : asc[i]=0x54; break;
-         case 'U'  : asc[i]=0x55; break;
-         case 'V'  : asc[i]=0x56; break;
-         case 'W'  : asc[i]=0x57; break;
-         case 'X'  : asc[i]=0x58; break;
-         case 'Y'  : asc[i]=0x59; break;
-         case 'Z'  : asc[i]=0x5A; break;
-         case '_'  : asc[i]=0x5F; break;
-
-         case 'a'  : asc[i]=0x61; break;
-         case 'b'  : asc[i]=0x62; break;
-         case 'c'  : asc[i]=0x63; break;
-         case 'd'  : asc[i]=0x64; break;
-         case 'e'  : asc[i]=0x65; break;
-         case 'f'  : asc[i]=0x66; break;
-         case 'g'  : asc[i]=0x67; break;
-         case 'h'  : asc[i]=0x68; break;
-         case 'i'  : asc[i]=0x69; break;
-         case 'j'  : asc[i]=0x6A; break;
-         case 'k'  : asc[i]=0x6B; break;
-         case 'l'  : asc[i]=0x6C; break;
-         case 'm'  : asc[i]=0x6D; break;
-         case 'n'  : asc[i]=0x6E; break;
-         case 'o'  : asc[i]=0x6F; break;
-
-         case 'p'  : asc[i]=0x70; break;
-         case 'q'  : asc[i]=0x71; break;
-         case 'r'  : asc[i]=0x72; break;
-         case 's'  : asc[i]=0x73; break;
-         case 't'  : asc[i]=0x74; break;
-         case 'u'  : asc[i]=0x75; break;
-         case 'v'  : asc[i]=0x76; break;
-         case 'w'  : asc[i]=0x77; break;
-         case 'x'  : asc[i]=0x78; break;
-         case 'y'  : asc[i]=0x79; break;
-         case 'z'  : asc[i]=0x7A; break;
-         default   :
-            if (chr[i]==C_EXC) {
-               asc[i]=0x21;
-            } else if (chr[i]==C_HSH) {
-               asc[i]=0x23;
-            } else if (chr[i]==C_DLR) {
-               asc[i]=0x24;
-            } else if (chr[i]==C_ATS) {
-               asc[i]=0x40;
-            } else if (chr[i]==C_SBO) {
-               asc[i]=0x5B;
-            } else if (chr[i]==C_BSL) {
-               asc[i]=0x5C;
-            } else if (chr[i]==C_SBC) {
-               asc[i]=0x5D;
-            } else if (chr[i]==C_CRT) {
-               asc[i]=0x5E;
-            } else if (chr[i]==C_GRV) {
-               asc[i]=0x60;
-            } else if (chr[i]==C_CBO) {
-               asc[i]=0x7B;
-            } else if (chr[i]==C_VBR) {
-               asc[i]=0x7C;
-            } else if (chr[i]==C_CBC) {
-               asc[i]=0x7D;
-            } else if (chr[i]==C_TLD) {
-               asc[i]=0x7E;
-            } else {
-               asc[i]=0x5F;
-            }
-            break;
-      }
-   }
+   CHRTAB(tab,acChrAsu);
+   uiChrCnv(chr,asc,len,tab,FALSE,TRUE);
 }
 
 extern unsigned int ebc2chr(
@@ -3758,44 +3783,8 @@ extern unsigned int ebc2chr(
          char*          chr,
    const unsigned int   len)
 {
-   unsigned int         i;
-   const char           ebc_map[256]={
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'\r',0x0, 0x0,
-   0x0,0x0,0x0,0x0,0x0,'\n',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0, 0x0, 0x0,
-   0x0,0x0,0x0,0x0,0x0,'\n',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0, 0x0, 0x0,
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0, 0x0, 0x0,
-   ' ',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'.','<','(', '+', '|',   /*nodiac*/
-   '&',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'!','$','*',')', ';', '^',   /*nodiac*/
-   '-','/',0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,',','%','_', '>', '\?',  /*nodiac*/
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,'`',':','#','@','\'','=','\"',   /*nodiac*/
-   0x0,'a','b','c','d','e','f','g','h','i',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
-   0x0,'j','k','l','m','n','o','p','q','r',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
-   0x0,'~','s','t','u','v','w','x','y','z',0x0,0x0,0x0,'[', 0x0, 0x0,   /*nodiac*/
-   0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,']', 0x0, 0x0,   /*nodiac*/
-   '{','A','B','C','D','E','F','G','H','I',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
-   '}','J','K','L','M','N','O','P','Q','R',0x0,0x0,0x0,0x0, 0x0, 0x0,   /*nodiac*/
-   '\\',0x0,'S','T','U','V','W','X','Y','Z',0x0,0x0,0x0,0x0, 0x0, 0x0,  /*nodiac*/
-   '0','1','2','3','4','5','6','7','8','9',0x0,0x0,0x0,0x0, 0x0, 0x0};  /*nodiac*/
-   for (i=0;i<len;i++) {
-      chr[i]=ebc_map[*((unsigned char*)(ebc+i))];
-      switch (chr[i]) {
-      case '!' : chr[i]=C_EXC; break;  /*nodiac*/
-      case '$' : chr[i]=C_DLR; break;  /*nodiac*/
-      case '#' : chr[i]=C_HSH; break;  /*nodiac*/
-      case '@' : chr[i]=C_ATS; break;  /*nodiac*/
-      case '[' : chr[i]=C_SBO; break;  /*nodiac*/
-      case '\\': chr[i]=C_BSL; break;  /*nodiac*/
-      case ']' : chr[i]=C_SBC; break;  /*nodiac*/
-      case '^' : chr[i]=C_CRT; break;  /*nodiac*/
-      case '`' : chr[i]=C_GRV; break;  /*nodiac*/
-      case '{' : chr[i]=C_CBO; break;  /*nodiac*/
-      case '|' : chr[i]=C_VBR; break;  /*nodiac*/
-      case '}' : chr[i]=C_CBC; break;  /*nodiac*/
-      case '~' : chr[i]=C_TLD; break;  /*nodiac*/
-      case 0x0 : return(i);
-      }
-   }
-   return(i);
+   CHRTAB(tab,acEbcChr);
+   return(uiChrCnv(ebc,chr,len,tab,TRUE,FALSE));
 }
 
 extern void ebc_chr(
@@ -3803,42 +3792,8 @@ extern void ebc_chr(
          char*          chr,
    const unsigned int   len)
 {
-   unsigned int         i;
-   const char           ebc_map[256]={
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','\r', '_', '_',  /*nodiac*/
-   '_','_','_','_','_','\n','_','_','_','_','_','_','_','_', '_', '_',  /*nodiac*/
-   '_','_','_','_','_','\n','_','_','_','_','_','_','_','_', '_', '_',  /*nodiac*/
-   '_','_','_','_','_','_','_','_','_','_','_','_','_','_', '_', '_',   /*nodiac*/
-   ' ','_','_','_','_','_','_','_','_','_','_','.','<','(', '+', '|',   /*nodiac*/
-   '&','_','_','_','_','_','_','_','_','_','!','$','*',')', ';', '^',   /*nodiac*/
-   '-','/','_','_','_','_','_','_','_','_','_',',','%','_', '>', '\?',  /*nodiac*/
-   '_','_','_','_','_','_','_','_','_','`',':','#','@','\'','=','\"',   /*nodiac*/
-   '_','a','b','c','d','e','f','g','h','i','_','_','_','_', '_', '_',   /*nodiac*/
-   '_','j','k','l','m','n','o','p','q','r','_','_','_','_', '_', '_',   /*nodiac*/
-   '_','~','s','t','u','v','w','x','y','z','_','_','_','[', '_', '_',   /*nodiac*/
-   '_','_','_','_','_','_','_','_','_','_','_','_','_',']', '_', '_',   /*nodiac*/
-   '{','A','B','C','D','E','F','G','H','I','_','_','_','_', '_', '_',   /*nodiac*/
-   '}','J','K','L','M','N','O','P','Q','R','_','_','_','_', '_', '_',   /*nodiac*/
-   '\\','_','S','T','U','V','W','X','Y','Z','_','_','_','_', '_', '_',  /*nodiac*/
-   '0','1','2','3','4','5','6','7','8','9','_','_','_','_', '_', '_'};  /*nodiac*/
-   for (i=0;i<len;i++) {
-      chr[i]=ebc_map[*((unsigned char*)(ebc+i))];
-      switch (chr[i]) {
-      case '!' : chr[i]=C_EXC; break;  /*nodiac*/
-      case '$' : chr[i]=C_DLR; break;  /*nodiac*/
-      case '#' : chr[i]=C_HSH; break;  /*nodiac*/
-      case '@' : chr[i]=C_ATS; break;  /*nodiac*/
-      case '[' : chr[i]=C_SBO; break;  /*nodiac*/
-      case '\\': chr[i]=C_BSL; break;  /*nodiac*/
-      case ']' : chr[i]=C_SBC; break;  /*nodiac*/
-      case '^' : chr[i]=C_CRT; break;  /*nodiac*/
-      case '`' : chr[i]=C_GRV; break;  /*nodiac*/
-      case '{' : chr[i]=C_CBO; break;  /*nodiac*/
-      case '|' : chr[i]=C_VBR; break;  /*nodiac*/
-      case '}' : chr[i]=C_CBC; break;  /*nodiac*/
-      case '~' : chr[i]=C_TLD; break;  /*nodiac*/
-      }
-   }
+   CHRTAB(tab,acEbcChu);
+   uiChrCnv(ebc,chr,len,tab,FALSE,FALSE);
 }
 
 extern void chr_ebc(
@@ -3846,153 +3801,19 @@ extern void chr_ebc(
          char*          ebc,
    const unsigned int   len)
 {
-   unsigned int         i;
-   for (i=0;i<len;i++) {
-      switch (chr[i]) {
-      case 0x00 : ebc[i]=0x00; break;
-      case '\n' : ebc[i]=0x25; break;
-      case '\r' : ebc[i]=0x0D; break;
-
-      case ' '  : ebc[i]=0x40; break;
-      case '\"' : ebc[i]=0x7F; break;
-      case '%'  : ebc[i]=0x6C; break;
-      case '&'  : ebc[i]=0x50; break;
-      case '\'' : ebc[i]=0x7D; break;
-      case '('  : ebc[i]=0x4D; break;
-      case ')'  : ebc[i]=0x5D; break;
-      case '*'  : ebc[i]=0x5C; break;
-      case '+'  : ebc[i]=0x4E; break;
-      case ','  : ebc[i]=0x6B; break;
-      case '-'  : ebc[i]=0x60; break;
-      case '.'  : ebc[i]=0x4B; break;
-      case '/'  : ebc[i]=0x61; break;
-
-      case '0'  : ebc[i]=0xF0; break;
-      case '1'  : ebc[i]=0xF1; break;
-      case '2'  : ebc[i]=0xF2; break;
-      case '3'  : ebc[i]=0xF3; break;
-      case '4'  : ebc[i]=0xF4; break;
-      case '5'  : ebc[i]=0xF5; break;
-      case '6'  : ebc[i]=0xF6; break;
-      case '7'  : ebc[i]=0xF7; break;
-      case '8'  : ebc[i]=0xF8; break;
-      case '9'  : ebc[i]=0xF9; break;
-      case ':'  : ebc[i]=0x7A; break;
-      case ';'  : ebc[i]=0x5E; break;
-      case '<'  : ebc[i]=0x4C; break;
-      case '='  : ebc[i]=0x7E; break;
-      case '>'  : ebc[i]=0x6E; break;
-      case '?'  : ebc[i]=0x6F; break;
-
-      case 'A'  : ebc[i]=0xC1; break;
-      case 'B'  : ebc[i]=0xC2; break;
-      case 'C'  : ebc[i]=0xC3; break;
-      case 'D'  : ebc[i]=0xC4; break;
-      case 'E'  : ebc[i]=0xC5; break;
-      case 'F'  : ebc[i]=0xC6; break;
-      case 'G'  : ebc[i]=0xC7; break;
-      case 'H'  : ebc[i]=0xC8; break;
-      case 'I'  : ebc[i]=0xC9; break;
-      case 'J'  : ebc[i]=0xD1; break;
-      case 'K'  : ebc[i]=0xD2; break;
-      case 'L'  : ebc[i]=0xD3; break;
-      case 'M'  : ebc[i]=0xD4; break;
-      case 'N'  : ebc[i]=0xD5; break;
-      case 'O'  : ebc[i]=0xD6; break;
-
-      case 'P'  : ebc[i]=0xD7; break;
-      case 'Q'  : ebc[i]=0xD8; break;
-      case 'R'  : ebc[i]=0xD9; break;
-      case 'S'  : ebc[i]=0xE2; break;
-      case 'T'  : ebc[i]=0xE3; break;
-      case 'U'  : ebc[i]=0xE4; break;
-      case 'V'  : ebc[i]=0xE5; break;
-      case 'W'  : ebc[i]=0xE6; break;
-      case 'X'  : ebc[i]=0xE7; break;
-      case 'Y'  : ebc[i]=0xE8; break;
-      case 'Z'  : ebc[i]=0xE9; break;
-      case '_'  : ebc[i]=0x6D; break;
-
-      case 'a'  : ebc[i]=0x81; break;
-      case 'b'  : ebc[i]=0x82; break;
-      case 'c'  : ebc[i]=0x83; break;
-      case 'd'  : ebc[i]=0x84; break;
-      case 'e'  : ebc[i]=0x85; break;
-      case 'f'  : ebc[i]=0x86; break;
-      case 'g'  : ebc[i]=0x87; break;
-      case 'h'  : ebc[i]=0x88; break;
-      case 'i'  : ebc[i]=0x89; break;
-      case 'j'  : ebc[i]=0x91; break;
-      case 'k'  : ebc[i]=0x92; break;
-      case 'l'  : ebc[i]=0x93; break;
-      case 'm'  : ebc[i]=0x94; break;
-      case 'n'  : ebc[i]=0x95; break;
-      case 'o'  : ebc[i]=0x96; break;
-
-      case 'p'  : ebc[i]=0x97; break;
-      case 'q'  : ebc[i]=0x98; break;
-      case 'r'  : ebc[i]=0x99; break;
-      case 's'  : ebc[i]=0xA2; break;
-      case 't'  : ebc[i]=0xA3; break;
-      case 'u'  : ebc[i]=0xA4; break;
-      case 'v'  : ebc[i]=0xA5; break;
-      case 'w'  : ebc[i]=0xA6; break;
-      case 'x'  : ebc[i]=0xA7; break;
-      case 'y'  : ebc[i]=0xA8; break;
-      case 'z'  : ebc[i]=0xA9; break;
-
-      default   :
-         if (chr[i]==C_EXC) {
-            ebc[i]=0x5A;
-         } else if (chr[i]==C_HSH) {
-            ebc[i]=0x7B;
-         } else if (chr[i]==C_DLR) {
-            ebc[i]=0x5B;
-         } else if (chr[i]==C_ATS) {
-            ebc[i]=0x7C;
-         } else if (chr[i]==C_SBO) {
-            ebc[i]=0xAD;
-         } else if (chr[i]==C_BSL) {
-            ebc[i]=0xE0;
-         } else if (chr[i]==C_SBC) {
-            ebc[i]=0xBD;
-         } else if (chr[i]==C_CRT) {
-            ebc[i]=0x5F;
-         } else if (chr[i]==C_GRV) {
-            ebc[i]=0x79;
-         } else if (chr[i]==C_CBO) {
-            ebc[i]=0xC0;
-         } else if (chr[i]==C_VBR) {
-            ebc[i]=0x4F;
-         } else if (chr[i]==C_CBC) {
-            ebc[i]=0xD0;
-         } else if (chr[i]==C_TLD) {
-            ebc[i]=0xA1;
-         } else {
-            ebc[i]=0x6D;
-         }
-         break;
-      }
-   }
+   CHRTAB(tab,acChrEbu);
+   uiChrCnv(chr,ebc,len,tab,FALSE,FALSE);
 }
 
-extern int file2str(const void* hdl, const char* filename, char** buf, int* bufsize, char* errmsg, const int msgsiz) {
-   int siLen=0, siHlp;
-   char* pcHlp;
-   FILE* pfFile=NULL;
-   const int freadLen=65536;
-
+extern int file2stm(const void* hdl, const char* filename, FILE** file, char* errmsg, const int msgsiz) {
    (void)(hdl);//unsued
 
-   if (filename==NULL || buf==NULL || bufsize==NULL || (*buf!=NULL && (*bufsize<=0))) {
+   if (filename==NULL || file==NULL) {
       if (errmsg!=NULL && msgsiz) {
-         snprintf(errmsg,msgsiz,"Illegal parameters passed to file2str(%p,%p,%p) (Bug)",filename,buf,bufsize);
+         snprintf(errmsg,msgsiz,"Illegal parameters passed to file2stm(%p,%p) (Bug)",filename,file);
       }
       return -1; // bad args
    }
-   if (*buf==NULL) {
-      *bufsize=0;
-   }
 #if !defined(__USS__) && !defined(__ZOS__) && defined(__FL5__)
       int r=siGetMFNameNative(filename, &filename, NULL);
       if (r && r!=-4) {
@@ -4003,13 +3824,35 @@ extern int file2str(const void* hdl, const char* filename, char** buf, int* bufs
       }
 #endif
    errno=0;
-   pfFile=fopen_hfq(filename, "rb");
-   if (pfFile == NULL) {
+   *file=fopen_hfq(filename, "rb");
+   if (*file == NULL) {
       if (errmsg!=NULL && msgsiz) {
          snprintf(errmsg,msgsiz,"Open of file (%s) failed (%d - %s)",filename,errno,pcSysError(errno));
       }
       return -2; // fopen failed
    }
+   return 0;
+}
+
+extern int file2str(const void* hdl, const char* filename, char** buf, int* bufsize, char* errmsg, const int msgsiz) {
+   int siLen=0, siHlp, siErr;
+   char* pcHlp;
+   FILE* pfFile=NULL;
+   const int freadLen=65536;
+
+   if (filename==NULL || buf==NULL || bufsize==NULL || (*buf!=NULL && (*bufsize<=0))) {
+      if (errmsg!=NULL && msgsiz) {
+         snprintf(errmsg,msgsiz,"Illegal parameters passed to file2str(%p,%p,%p) (Bug)",filename,buf,bufsize);
+      }
+      return -1; // bad args
+   }
+   if (*buf==NULL) {
+      *bufsize=0;
+   }
+   siErr=file2stm(hdl, filename, &pfFile, errmsg, msgsiz);
+   if (siErr) {
+      return siErr;
+   }
    while (!ferror(pfFile) && !feof(pfFile)) {
       if (*bufsize-siLen<freadLen+1) {
          if (*bufsize>INT_MAX-(freadLen*2+1)) {
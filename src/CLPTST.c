@@ -32,6 +32,7 @@
 
 #include "CLEPUTL.h"
 #include "FLAMCLP.h"
+#include "FLAMCLE.h"
 
 typedef C08  string5[5];
 
@@ -119,6 +120,29 @@ typedef struct Main {
    MAIN_TABLE
 } TsMain;
 
+#define PART_TABLE \
+   CLPARGTAB_SKALAR("INPUT" , stInp, TsTst, 0, 1, CLPTYP_OBJECT, CLPFLG_NON, 1, asClpTst, NULL, NULL, "Struture to define inbound parameter")  \
+   CLPARGTAB_CLS
+typedef struct Part {
+   PART_TABLE
+} TsPart;
+
+#define DYNOBJ_TABLE \
+   CLPARGTAB_DYNSTR("TXT", pcTxt, 64, 0, 1, CLPTYP_STRING, CLPFLG_NON, 1, NULL, NULL, NULL, "Dynamic string in dynamic array") \
+   CLPARGTAB_CLS
+typedef struct DynObj {
+   DYNOBJ_TABLE
+} TsDynObj;
+
+#define DYNAMIC_TABLE \
+   CLPARGTAB_DYNSTR("STR", pcStr   ,       64, 0,  1, CLPTYP_STRING, CLPFLG_NON, 1, NULL       , NULL, NULL, "Dynamic string")               \
+   CLPARGTAB_SKALAR("OBJ", siObjCnt,      I32, 0,  1, CLPTYP_NUMBER, CLPFLG_CNT, 2, NULL       , NULL, NULL, "32 bit integer for objcnt")    \
+   CLPARGTAB_DYNARY("OBJ", psObj   , TsDynObj, 0, 16, CLPTYP_OBJECT, CLPFLG_NON, 3, asClpDynObj, NULL, NULL, "Dynamic array of objects")     \
+   CLPARGTAB_CLS
+typedef struct Dynamic {
+   DYNAMIC_TABLE
+} TsDynamic;
+
 /*---------------------------------------------------------*/
 
 #undef DEFINE_STRUCT
@@ -181,6 +205,24 @@ TsClpArgument asMainArgTab[] = {
    MAIN_TABLE
 };
 
+#undef  STRUCT_NAME
+#define STRUCT_NAME TsPart
+TsClpArgument asPartArgTab[] = {
+   PART_TABLE
+};
+
+#undef  STRUCT_NAME
+#define STRUCT_NAME TsDynObj
+TsClpArgument asClpDynObj[] = {
+   DYNOBJ_TABLE
+};
+
+#undef  STRUCT_NAME
+#define STRUCT_NAME TsDynamic
+TsClpArgument asDynArgTab[] = {
+   DYNAMIC_TABLE
+};
+
 /******************************************************************************/
 
 static void printNumTypes(
@@ -292,6 +334,651 @@ static void printMain(
 
 /******************************************************************************/
 
+static void* pvTstOpn(
+   const char*             pcCmd,
+   const TsClpArgument*    psTab,
+   void*                   pvDat,
+   TsClpError*             psErr)
+{
+   return(pvClpOpen(FALSE,TRUE,TRUE,1,"limes","CLPTST","v1r0",pcCmd,"man-page","help-msg",FALSE,psTab,pvDat,stderr,(psErr!=NULL)?NULL:stderr,
+                    NULL,NULL,NULL,NULL,"-->","/",",",psErr,NULL,NULL,NULL,NULL,NULL));
+}
+
+static int siTstEnd(
+   const char*             pcTst,
+   const int               siErr)
+{
+   fprintf(stderr,"*** %s %s ***\n",pcTst,siErr?"FAILED":"SUCCESSFULL");
+   return(siErr);
+}
+
+static int siSnpDummy=-1;
+
+static int siSnpEnv(FILE* pfOut, FILE* pfErr)
+{
+   return(0);
+}
+
+/* Runs a command with CLE and returns the DUMMY value of the LOG object passed to the run function.*/
+static int siTstCle(
+   const TsCleCommand*     psCmd,
+   int                     argc,
+   char*                   argv[])
+{
+   CLEDOC_OPN(asDoc)={
+      CLETAB_DOC(CLE_DOCTYP_COVER,1,NULL,NULL,NULL,"CLPTST",NULL,NULL)
+      CLEDOC_CLS
+   };
+   siSnpDummy=-1;
+   siCleExecute(siSnpEnv,NULL,NULL,psCmd,argc,argv,"limes","clptst",NULL,NULL,FALSE,TRUE,TRUE,0,stderr,NULL,"-->","/",",",
+                "license","1","version","about","CLPTST",NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,0,asDoc,NULL,NULL);
+   return(siSnpDummy);
+}
+
+static int siSnpIni(void* pvHdl, FILE* pfOut, FILE* pfTrc, void* pvGbl, const char* pcOwn, const char* pcPgm, const int siOid, void* pvClp)
+{
+   memset(pvClp,0,sizeof(TsLog));
+   return(0);
+}
+
+static int siSnpMap(void* pvHdl, FILE* pfOut, FILE* pfTrc, void* pvGbl, const int siOid, void* pvClp, void* pvPar)
+{
+   memcpy(pvPar,pvClp,sizeof(TsLog));
+   return(0);
+}
+
+static int siSnpRun(void* pvHdl, FILE* pfOut, FILE* pfTrc, void* pvGbl, const char* pcOwn, const char* pcPgm, const char* pcVsn, const char* pcAbo,
+                    const char* pcLic, const char* pcFkt, const char* pcCmd, const char* pcLst, const int siOid, const void* pvPar, int* piWrn, int* piScc)
+{
+   siSnpDummy=((const TsLog*)pvPar)->uiDummy;
+   return(0);
+}
+
+static int siSnpFin(FILE* pfOut, FILE* pfTrc, void* pvGbl, const int siOid, void* pvPar)
+{
+   return(0);
+}
+
+static int siSnpPut(const char* pcFil, const char* pcTxt)
+{
+   FILE* pfFil=fopen(pcFil,"w");
+   if (pfFil==NULL) return(-1);
+   fputs(pcTxt,pfFil);
+   fclose(pfFil);
+   return(0);
+}
+
+static int siSnpExe(void)
+{
+   TsLog             stClp;
+   TsLog             stPar;
+   CLECMD_OPN(asCmd)={
+      CLETAB_CMD("SNAP",asClpLog,&stClp,&stPar,NULL,siSnpIni,siSnpMap,siSnpRun,siSnpFin,1,"Snapshot test","Snapshot test")
+      CLECMD_CLS
+   };
+   char*             apArg[]={"clptst","SNAP","DUMMY=0",NULL};
+   return(siTstCle(asCmd,2,apArg));
+}
+
+/* Snapshots of properties: the properties of a handle are captured and applied to another handle,
+ * a failed apply must leave the handle unchanged, and the property cache of CLE must see a property
+ * file which is rewritten in place with the same size within the same second.*/
+static int siTestSnapshot(void)
+{
+   void*             pvHd1;
+   void*             pvHd2;
+   void*             pvHd3;
+   void*             pvSnp;
+   TsMain            stMa1;
+   TsMain            stMa2;
+   TsPart            stPart;
+   char*             pcLst=NULL;
+   int               siErr=0;
+
+   memset(&stMa1,0,sizeof(stMa1));
+   memset(&stMa2,0,sizeof(stMa2));
+   pvHd1=pvTstOpn("MAIN",asMainArgTab,&stMa1,NULL);
+   pvHd2=pvTstOpn("MAIN",asMainArgTab,&stMa2,NULL);
+   if (pvHd1==NULL || pvHd2==NULL) {
+      fprintf(stderr,"Open of handles for snapshot test failed\n");
+      siErr=1;
+   } else {
+      if (siClpParsePro(pvHd1,"snapshot","limes.CLPTST.MAIN.LOG.DUMMY=\"7\" limes.CLPTST.MAIN.INPUT.NUM.NUM08=\"9\"",TRUE,NULL)!=2) {
+         fprintf(stderr,"Parsing of properties for snapshot failed\n"); siErr=1;
+      }
+      pvSnp=pvClpSnapPro(pvHd1);
+      if (pvSnp==NULL) {
+         fprintf(stderr,"Snapshot of properties failed\n"); siErr=1;
+      } else {
+         if (siClpApplyPro(pvHd2,pvSnp,TRUE)!=2) {
+            fprintf(stderr,"Apply of property snapshot failed\n"); siErr=1;
+         }
+         if (siClpParseCmd(pvHd2,NULL,"LOG() INPUT(NUM(NUM32=1))",TRUE,TRUE,NULL,&pcLst)<0 || stMa2.stLog.uiDummy!=7 || stMa2.stInp.stNum.uiNum08!=9) {
+            fprintf(stderr,"Properties from snapshot not used (DUMMY=%d NUM08=%d)\n",(int)stMa2.stLog.uiDummy,(int)stMa2.stInp.stNum.uiNum08); siErr=1;
+         }
+         vdClpFreePro(pvSnp);
+      }
+      vdClpClose(pvHd2,CLPCLS_MTD_ALL);
+      pvHd2=pvTstOpn("OTHER",asMainArgTab,&stMa2,NULL);
+      pvHd3=pvTstOpn("MAIN",asPartArgTab,&stPart,NULL);
+      pvSnp=pvClpSnapPro(pvHd1);
+      if (pvHd2==NULL || pvHd3==NULL || pvSnp==NULL) {
+         fprintf(stderr,"Open of handles for failing apply failed\n"); siErr=1;
+      } else {
+         memset(&stMa2,0,sizeof(stMa2));
+         memset(&stPart,0,sizeof(stPart));
+         siClpParsePro(pvHd2,"snapshot","limes.CLPTST.OTHER.LOG.DUMMY=\"3\"",TRUE,NULL);
+         if (siClpApplyPro(pvHd2,pvSnp,FALSE)<0) { // other root is ignored without check
+            fprintf(stderr,"Apply of property snapshot without root check failed\n"); siErr=1;
+         }
+         if (siClpApplyPro(pvHd2,pvSnp,TRUE)>=0) {  // other root is an error with check
+            fprintf(stderr,"Apply of property snapshot with wrong root does not fail\n"); siErr=1;
+         }
+         if (siClpParseCmd(pvHd2,NULL,"LOG()",TRUE,TRUE,NULL,&pcLst)<0 || stMa2.stLog.uiDummy!=3) {
+            fprintf(stderr,"Properties changed by apply with wrong root (DUMMY=%d)\n",(int)stMa2.stLog.uiDummy); siErr=1;
+         }
+         siClpParsePro(pvHd3,"snapshot","limes.CLPTST.MAIN.INPUT.NUM.NUM08=\"5\"",TRUE,NULL);
+         if (siClpApplyPro(pvHd3,pvSnp,TRUE)>=0) {  // NUM08 is applied but LOG is not part of the table
+            fprintf(stderr,"Apply of property snapshot with unknown path does not fail\n"); siErr=1;
+         }
+         if (siClpParseCmd(pvHd3,NULL,"INPUT(NUM(NUM32=1))",TRUE,TRUE,NULL,&pcLst)<0 || stPart.stInp.stNum.uiNum08!=5) {
+            fprintf(stderr,"Properties not rolled back after failed apply (NUM08=%d)\n",(int)stPart.stInp.stNum.uiNum08); siErr=1;
+         }
+      }
+      vdClpFreePro(pvSnp);
+      if (pvHd3!=NULL) vdClpClose(pvHd3,CLPCLS_MTD_ALL);
+      if (pvHd2!=NULL) vdClpClose(pvHd2,CLPCLS_MTD_ALL);
+      vdClpClose(pvHd1,CLPCLS_MTD_ALL);
+   }
+   if (siSnpPut("clptst.cfg","limes.clptst.SNAP.property.file=clptst.pro\n") ||
+       siSnpPut("clptst.pro","limes.clptst.SNAP.DUMMY=\"1\"\n") || setenv("CLPTST_CONFIG_FILE","clptst.cfg",1)) {
+      fprintf(stderr,"Write of configuration and property file failed\n"); siErr=1;
+   } else {
+      int siDm1=siSnpExe();
+      int siDm2=siSnpExe();
+      siSnpPut("clptst.pro","limes.clptst.SNAP.DUMMY=\"2\"\n");
+      int siDm3=siSnpExe();
+      if (siDm1!=1 || siDm2!=1 || siDm3!=2) {
+         fprintf(stderr,"Property snapshot of CLE not valid (DUMMY=%d/%d/%d expected 1/1/2)\n",siDm1,siDm2,siDm3); siErr=1;
+      }
+      unsetenv("CLPTST_CONFIG_FILE");
+      remove("clptst.cfg");
+      remove("clptst.pro");
+   }
+   return(siTstEnd("SNAPSHOT TEST",siErr));
+}
+
+/* Hex conversion: a known value, a round trip of each length up to 300 bytes (vector and byte loops of the
+ * conversion) with mixed case hex digits and the stop at an invalid digit at each position of 64 bytes.*/
+static int siTestHex(void)
+{
+   static const unsigned char auKnw[4]={0x00,0x9F,0xA5,0xFF};
+   unsigned char     auBin[300];
+   unsigned char     auCmp[300];
+   char              acHex[2*300+1];
+   unsigned int      uiLen;
+   unsigned int      i;
+   int               siErr=0;
+   for (i=0;i<sizeof(auBin);i++) auBin[i]=(unsigned char)((i*2654435761U)>>13);
+   memset(acHex,0,sizeof(acHex));
+   if (bin2hex(auKnw,acHex,4)!=8 || strcmp(acHex,"009FA5FF") || hex2bin("009fA5Ff",auCmp,8)!=4 || memcmp(auKnw,auCmp,4)) {
+      fprintf(stderr,"Conversion of known value failed (%s)\n",acHex); siErr=1;
+   }
+   for (uiLen=0;uiLen<=sizeof(auBin) && !siErr;uiLen++) {
+      memset(auCmp,0,sizeof(auCmp));
+      if (bin2hex(auBin,acHex,uiLen)!=2*uiLen) siErr=1;
+      for (i=0;i<2*uiLen;i+=3) acHex[i]=(char)tolower((unsigned char)acHex[i]);
+      if (hex2bin(acHex,auCmp,2*uiLen)!=uiLen || memcmp(auBin,auCmp,uiLen)) siErr=1;
+      if (siErr) fprintf(stderr,"Round trip of %u bytes failed\n",uiLen);
+   }
+   for (i=0;i<128 && !siErr;i++) {
+      bin2hex(auBin,acHex,64);
+      acHex[i]='g';
+      if (hex2bin(acHex,auCmp,128)!=i/2 || memcmp(auBin,auCmp,i/2)) {
+         fprintf(stderr,"Conversion with invalid hex digit at position %u failed\n",i); siErr=1;
+      }
+   }
+   return(siTstEnd("HEX TEST",siErr));
+}
+
+/* Throughput of bin2hex and hex2bin from 1 KiB to 64 MiB of binary data (at least 16 MiB per size),
+ * each size is also checked for a round trip with mixed case hex digits and an invalid character.
+ * The benchmark runs only if the first argument of clptst is -bench.*/
+static int siTestHexBench(void)
+{
+   unsigned char*    pcBin;
+   unsigned char*    pcCmp;
+   char*             pcHex;
+   unsigned int      uiLen;
+   unsigned int      uiMax=64*1024*1024;
+   unsigned int      i;
+   int               siErr=0;
+   pcBin=(unsigned char*)malloc(uiMax);
+   pcCmp=(unsigned char*)malloc(uiMax);
+   pcHex=(char*)malloc(2*(size_t)uiMax);
+   if (pcBin==NULL || pcCmp==NULL || pcHex==NULL) {
+      fprintf(stderr,"Allocation of memory for hex benchmark failed\n");
+      free(pcBin); free(pcCmp); free(pcHex);
+      return(siTstEnd("HEX BENCHMARK",1));
+   }
+   for (i=0;i<uiMax;i++) pcBin[i]=(unsigned char)((i*2654435761U)>>13);
+   fprintf(stderr,"*** HEX BENCHMARK (MiB of binary data per second) ***\n");
+   for (uiLen=1024;uiLen<=uiMax && !siErr;uiLen*=16) {
+      unsigned int   uiRep=uiLen<16*1024*1024?16*1024*1024/uiLen:1;
+      unsigned int   r;
+      clock_t        t0,t1,t2;
+      t0=clock();
+      for (r=0;r<uiRep;r++) {
+         if (bin2hex(pcBin,pcHex,uiLen)!=2*uiLen) siErr=1;
+      }
+      t1=clock();
+      for (r=0;r<uiRep;r++) {
+         if (hex2bin(pcHex,pcCmp,2*uiLen)!=uiLen) siErr=1;
+      }
+      t2=clock();
+      if (siErr || memcmp(pcBin,pcCmp,uiLen)) {
+         fprintf(stderr,"Round trip of %u bytes failed\n",uiLen); siErr=1;
+         break;
+      }
+      for (i=0;i<2*uiLen;i+=3) pcHex[i]=(char)tolower((unsigned char)pcHex[i]);
+      pcHex[uiLen|1]='g';
+      if (hex2bin(pcHex,pcCmp,2*uiLen)!=uiLen/2 || memcmp(pcBin,pcCmp,uiLen/2)) {
+         fprintf(stderr,"Conversion of %u bytes with mixed case and invalid character failed\n",uiLen); siErr=1;
+         break;
+      }
+      fprintf(stderr,"%9u bytes: bin2hex %8.1f hex2bin %8.1f\n",uiLen,
+              (double)uiRep*uiLen/(1024.0*1024.0)/((double)(t1-t0+1)/CLOCKS_PER_SEC),
+              (double)uiRep*uiLen/(1024.0*1024.0)/((double)(t2-t1+1)/CLOCKS_PER_SEC));
+   }
+   free(pcBin); free(pcCmp); free(pcHex);
+   return(siTstEnd("HEX BENCHMARK",siErr));
+}
+
+static int siBlkChk(
+   const TsDynamic*  psDyn,
+   const char*       pcStr,
+   const char*       pcTx1,
+   const char*       pcTx2,
+   const char*       pcBlk,
+   const size_t      szBlk)
+{
+   if (psDyn->pcStr==NULL || strcmp((const char*)psDyn->pcStr,pcStr) || psDyn->siObjCnt!=2 || psDyn->psObj==NULL ||
+       psDyn->psObj[0].pcTxt==NULL || strcmp((const char*)psDyn->psObj[0].pcTxt,pcTx1) ||
+       psDyn->psObj[1].pcTxt==NULL || strcmp((const char*)psDyn->psObj[1].pcTxt,pcTx2)) {
+      return(1);
+   }
+   if ((const char*)psDyn->pcStr<pcBlk || (const char*)psDyn->pcStr>=pcBlk+szBlk ||
+       (const char*)psDyn->psObj<pcBlk || (const char*)psDyn->psObj>=pcBlk+szBlk ||
+       (const char*)psDyn->psObj[1].pcTxt<pcBlk || (const char*)psDyn->psObj[1].pcTxt>=pcBlk+szBlk) {
+      return(1);
+   }
+   return(0);
+}
+
+/* Close with one block: the dynamic strings and the dynamic array of objects with nested dynamic strings
+ * must be moved into the returned block, which stays usable and writable after the handle is closed and
+ * another handle was opened, parsed and closed in the same way, and is released with one free.*/
+static int siTestCloseBlk(void)
+{
+   TsDynamic         stDy1;
+   TsDynamic         stDy2;
+   void*             pvHdl;
+   char*             pcBl1=NULL;
+   char*             pcBl2=NULL;
+   size_t            szBl1=0;
+   size_t            szBl2=0;
+   int               siErr=0;
+
+   memset(&stDy1,0,sizeof(stDy1));
+   memset(&stDy2,0,sizeof(stDy2));
+   pvHdl=pvTstOpn("DYN",asDynArgTab,&stDy1,NULL);
+   if (pvHdl==NULL || siClpParseCmd(pvHdl,NULL,"STR='first dynamic string' OBJ[(TXT='one') (TXT='two two two two two two')]",TRUE,TRUE,NULL,NULL)<0) {
+      fprintf(stderr,"Open or parsing for close block test failed\n"); siErr=1;
+      if (pvHdl!=NULL) vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+   } else {
+      pcBl1=(char*)pvClpCloseBlk(pvHdl,&szBl1);
+      if (pcBl1==NULL || siBlkChk(&stDy1,"first dynamic string","one","two two two two two two",pcBl1,szBl1)) {
+         fprintf(stderr,"Values not moved into the block returned by close\n"); siErr=1;
+      }
+   }
+   pvHdl=pvTstOpn("DYN",asDynArgTab,&stDy2,NULL);
+   if (pvHdl==NULL || siClpParseCmd(pvHdl,NULL,"OBJ[(TXT='three three three three three three') (TXT='four')] STR='second dynamic string'",TRUE,TRUE,NULL,NULL)<0) {
+      fprintf(stderr,"Second open or parsing for close block test failed\n"); siErr=1;
+      if (pvHdl!=NULL) vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+   } else {
+      pcBl2=(char*)pvClpCloseBlk(pvHdl,&szBl2);
+      if (pcBl2==NULL || siBlkChk(&stDy2,"second dynamic string","three three three three three three","four",pcBl2,szBl2)) {
+         fprintf(stderr,"Values not moved into the second block returned by close\n"); siErr=1;
+      }
+   }
+   if (pcBl1!=NULL && !siErr) {
+      stDy1.psObj[0].pcTxt[0]='O';
+      stDy1.psObj[1].pcTxt[0]='T';
+      if (siBlkChk(&stDy1,"first dynamic string","One","Two two two two two two",pcBl1,szBl1)) {
+         fprintf(stderr,"Block returned by close not reusable after another handle was closed\n"); siErr=1;
+      }
+   }
+   free(pcBl1);
+   free(pcBl2);
+   return(siTstEnd("CLOSE BLOCK TEST",siErr));
+}
+
+static int siConDmy(
+   void*             pvHdl,
+   TsMain*           psMain,
+   const char*       pcCmd)
+{
+   if (siClpParseCmd(pvHdl,NULL,pcCmd,TRUE,TRUE,NULL,NULL)<0) return(-1);
+   return((int)psMain->stLog.uiDummy);
+}
+
+/* Flags determined while parsing belong to the symbol: a time literal given through an alias must not mark
+ * the target (which shares the value slot with the alias) as time value in later parse calls.*/
+static int siTestAlias(void)
+{
+   TsMain            stMain;
+   void*             pvHdl;
+   char*             pcLst=NULL;
+   int               siErr=0;
+
+   memset(&stMain,0,sizeof(stMain));
+   pvHdl=pvTstOpn("MAIN",asMainArgTab,&stMain,NULL);
+   if (pvHdl==NULL) {
+      fprintf(stderr,"Open of handle for alias test failed\n");
+      siErr=1;
+   } else {
+      if (siClpParseCmd(pvHdl,NULL,"INP(NUM(hug=0t1971/01/01.00:00:00))",TRUE,TRUE,NULL,&pcLst)<0 || pcLst==NULL || strstr(pcLst,"(1971-")==NULL) {
+         fprintf(stderr,"Time literal given through alias not listed as time value\n%s",(pcLst!=NULL)?pcLst:""); siErr=1;
+      }
+      if (siClpParseCmd(pvHdl,NULL,"INP(NUM(NUM32=1 NUM08=25))",TRUE,TRUE,NULL,&pcLst)<0 || pcLst==NULL || strstr(pcLst,"NUM32=d+1\n")==NULL) {
+         fprintf(stderr,"Number listed as time value after time literal given through alias\n%s",(pcLst!=NULL)?pcLst:""); siErr=1;
+      }
+      vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+   }
+   return(siTstEnd("ALIAS TEST",siErr));
+}
+
+/* Application constants: a constant used in a property default and on the command line is redefined,
+ * the perfect hash index must find the new value and the cache of compiled defaults must be invalidated.*/
+static int siTestConstant(void)
+{
+   TsMain            stMain;
+   void*             pvHdl;
+   char              acKyw[16];
+   int               siDm1,siDm2,siDm3,siDm4,siDm5;
+   int               siErr=0;
+   int               i;
+
+   memset(&stMain,0,sizeof(stMain));
+   pvHdl=pvTstOpn("MAIN",asMainArgTab,&stMain,NULL);
+   if (pvHdl==NULL) {
+      fprintf(stderr,"Open of handle for constant test failed\n");
+      siErr=1;
+   } else {
+      for (i=0;i<20 && !siErr;i++) {
+         sprintf(acKyw,"CON%02d",i);
+         if (siClpConstant(pvHdl,acKyw,CLPTYP_NUMBER,100+i,0.0,NULL)) siErr=1;
+      }
+      if (siErr || siClpConstant(pvHdl,"MYNUM",CLPTYP_NUMBER,5,0.0,NULL) ||
+          siClpParsePro(pvHdl,"constant","limes.CLPTST.MAIN.LOG.DUMMY=\"MYNUM*2\"",TRUE,NULL)!=1) {
+         fprintf(stderr,"Definition of constants or default property failed\n"); siErr=1;
+      } else {
+         siDm1=siConDmy(pvHdl,&stMain,"LOG()");
+         siDm2=siConDmy(pvHdl,&stMain,"LOG(DUMMY=mynum+CON07)");
+         if (siDm1!=10 || siDm2!=112) {
+            fprintf(stderr,"Values of constants not used (DUMMY=%d/%d expected 10/112)\n",siDm1,siDm2); siErr=1;
+         }
+         if (siClpConstant(pvHdl,"MYNUM",CLPTYP_NUMBER,7,0.0,NULL)) {
+            fprintf(stderr,"Redefinition of constant failed\n"); siErr=1;
+         }
+         siDm3=siConDmy(pvHdl,&stMain,"LOG()");
+         siDm4=siConDmy(pvHdl,&stMain,"LOG(DUMMY=MYNUM+con07)");
+         if (siClpConstant(pvHdl,"MYNEW",CLPTYP_NUMBER,1000,0.0,NULL)) {
+            fprintf(stderr,"Definition of constant after first lookup failed\n"); siErr=1;
+         }
+         siDm5=siConDmy(pvHdl,&stMain,"LOG(DUMMY=MYNUM+MYNEW+CON19)");
+         if (siDm3!=14 || siDm4!=114 || siDm5!=1126) {
+            fprintf(stderr,"Redefined constant not used (DUMMY=%d/%d/%d expected 14/114/1126)\n",siDm3,siDm4,siDm5); siErr=1;
+         }
+         if (siClpConstant(pvHdl,"PI",CLPTYP_NUMBER,3,0.0,NULL)==CLP_OK || siClpConstant(pvHdl,"mynum",CLPTYP_NUMBER,3,0.0,NULL)!=CLP_OK ||
+             siConDmy(pvHdl,&stMain,"LOG()")!=6) {
+            fprintf(stderr,"Predefined constant replaced or case insensitive redefinition failed\n"); siErr=1;
+         }
+      }
+      vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+   }
+   return(siTstEnd("CONSTANT TEST",siErr));
+}
+
+#define POLALC_CNT 65536
+static void*             apPolAlc[POLALC_CNT];
+static int               siPolAlc=0;
+static int               isPolErr=FALSE;
+
+static int siPolFnd(void* pvPtr)
+{
+   int i;
+   for (i=0;i<siPolAlc;i++) {
+      if (apPolAlc[i]==pvPtr) return(i);
+   }
+   return(-1);
+}
+
+static void* pvPolMalloc(void* pvAlc, size_t size)
+{
+   void* pvPtr;
+   if (siPolAlc>=POLALC_CNT) return(NULL);
+   pvPtr=(malloc)(size);
+   if (pvPtr!=NULL) apPolAlc[siPolAlc++]=pvPtr;
+   return(pvPtr);
+}
+
+static void* pvPolRealloc(void* pvAlc, void* ptr, size_t size)
+{
+   void* pvPtr;
+   int   i;
+   if (ptr==NULL) return(pvPolMalloc(pvAlc,size));
+   i=siPolFnd(ptr);
+   if (i<0) { isPolErr=TRUE; return(NULL); }
+   pvPtr=(realloc)(ptr,size);
+   if (pvPtr!=NULL) apPolAlc[i]=pvPtr;
+   return(pvPtr);
+}
+
+static void vdPolFree(void* pvAlc, void* ptr)
+{
+   int i;
+   if (ptr==NULL) return;
+   i=siPolFnd(ptr);
+   if (i<0) { isPolErr=TRUE; return; }
+   (free)(ptr);
+   apPolAlc[i]=apPolAlc[--siPolAlc];
+}
+
+static int siPolPar(const char* pcCmd)
+{
+   TsMain            stMain;
+   void*             pvHdl;
+   int               siErr;
+   memset(&stMain,0,sizeof(stMain));
+   pvHdl=pvTstOpn("MAIN",asMainArgTab,&stMain,NULL);
+   if (pvHdl==NULL) return(-1);
+   siErr=siClpParseCmd(pvHdl,NULL,pcCmd,TRUE,TRUE,NULL,NULL);
+   vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+   return((siErr<0)?-1:(int)stMain.stLog.uiDummy);
+}
+
+/* Buffer pool and allocators: the buffers pooled by a handle opened with the C library must not be
+ * reused (grown and released) by a handle opened with another process-wide allocator and vice versa.*/
+static int siTestPool(void)
+{
+   TsCleAlc          stAlc={NULL,pvPolMalloc,pvPolRealloc,vdPolFree};
+   char              acCmd[4096];
+   int               siDm1,siDm2,siDm3;
+   int               siErr=0;
+   int               l;
+
+   l=sprintf(acCmd,"LOG(DUMMY=");
+   memset(acCmd+l,'0',2048);
+   strcpy(acCmd+l+2048,"7)");
+   siDm1=siPolPar(acCmd);
+   cle_setalc(&stAlc,FALSE);
+   siDm2=siPolPar(acCmd);
+   cle_setalc(NULL,FALSE);
+   siDm3=siPolPar(acCmd);
+   if (siDm1!=7 || siDm2!=7 || siDm3!=7) {
+      fprintf(stderr,"Parsing with pooled buffers failed (DUMMY=%d/%d/%d expected 7/7/7)\n",siDm1,siDm2,siDm3); siErr=1;
+   }
+   if (isPolErr || siPolAlc) {
+      fprintf(stderr,"Memory of another allocator passed to the installed allocator or not released (%d)\n",siPolAlc); siErr=1;
+   }
+   return(siTstEnd("POOL TEST",siErr));
+}
+
+static size_t szWinPad(
+   char*             pcBuf,
+   size_t            szLen,
+   const size_t      szEnd)
+{
+   char              acLin[64];
+   int               siLin=0;
+   for (;;) {
+      int l=snprintf(acLin,sizeof(acLin),"; padding line %05d of the parameter file window test\n",siLin++);
+      if (szLen+l>szEnd) break;
+      memcpy(pcBuf+szLen,acLin,l);
+      szLen+=l;
+   }
+   while (szLen<szEnd) pcBuf[szLen++]=' ';
+   pcBuf[szLen]=0x00;
+   return(szLen);
+}
+
+static int siWinPar(
+   void*             pvHdl,
+   const char*       pcTxt)
+{
+   if (siSnpPut("clptst.par",pcTxt)) return(-1);
+   return(siClpParseCmd(pvHdl,NULL,"INPUT=>'clptst.par'",TRUE,TRUE,NULL,NULL));
+}
+
+static int siWinIni(void* pvHdl, FILE* pfOut, FILE* pfTrc, void* pvGbl, const char* pcOwn, const char* pcPgm, const int siOid, void* pvClp)
+{
+   memset(pvClp,0,sizeof(TsMain));
+   return(0);
+}
+
+static int siWinMap(void* pvHdl, FILE* pfOut, FILE* pfTrc, void* pvGbl, const int siOid, void* pvClp, void* pvPar)
+{
+   memcpy(pvPar,pvClp,sizeof(TsMain));
+   return(0);
+}
+
+static int siWinRun(void* pvHdl, FILE* pfOut, FILE* pfTrc, void* pvGbl, const char* pcOwn, const char* pcPgm, const char* pcVsn, const char* pcAbo,
+                    const char* pcLic, const char* pcFkt, const char* pcCmd, const char* pcLst, const int siOid, const void* pvPar, int* piWrn, int* piScc)
+{
+   siSnpDummy=((const TsMain*)pvPar)->stLog.uiDummy;
+   return(0);
+}
+
+static int siWinExe(
+   const char*       pcTxt)
+{
+   static TsMain     stClp;
+   static TsMain     stPar;
+   CLECMD_OPN(asCmd)={
+      CLETAB_CMD("WINDOW",asMainArgTab,&stClp,&stPar,NULL,siWinIni,siWinMap,siWinRun,siSnpFin,1,"Window test","Window test")
+      CLECMD_CLS
+   };
+   char*             apArg[]={"clptst","WINDOW","LOG=>'clptst.par'",NULL};
+   int               siDmy;
+   if (siSnpPut("clptst.par",pcTxt)) return(-1);
+   siDmy=siTstCle(asCmd,3,apArg);
+   remove("clptst.par");
+   return(siDmy);
+}
+
+/* Bounded input window: parameter files larger than the 64 KiB window with tokens across the refills,
+ * the row and column of an error behind a refill must refer to the file, and more than 256 replacements
+ * of environment variables in one and in consecutive parse calls. The same must work for a parameter file
+ * of a command executed by CLE without own file to string callback.*/
+static int siTestWindow(void)
+{
+   TsMain            stMain;
+   TsClpError        stErr;
+   void*             pvHdl;
+   char*             pcBuf;
+   char*             pcCmd;
+   char*             pcHlp;
+   size_t            szLen;
+   size_t            szErr;
+   int               siRow,siCol;
+   int               siErr=0;
+   int               i;
+
+   memset(&stMain,0,sizeof(stMain));
+   memset(&stErr,0,sizeof(stErr));
+   pcBuf=(char*)malloc(256*1024);
+   pcCmd=(char*)malloc(512*16);
+   pvHdl=pvTstOpn("MAIN",asMainArgTab,&stMain,&stErr);
+   if (pvHdl==NULL || pcBuf==NULL || pcCmd==NULL) {
+      fprintf(stderr,"Open of handle for window test failed\n");
+      free(pcBuf); free(pcCmd);
+      if (pvHdl!=NULL) vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+      return(siTstEnd("WINDOW TEST",1));
+   }
+   szLen=szWinPad(pcBuf,sprintf(pcBuf,"NUM(\n"),65536-4);
+   szLen+=sprintf(pcBuf+szLen,"NUM08=77 ");
+   szLen=szWinPad(pcBuf,szLen,2*65536-3);
+   szLen+=sprintf(pcBuf+szLen,"NUM32=4711 NUM64=NUM2\n");
+   szLen=szWinPad(pcBuf,szLen,3*65536);
+   szLen+=sprintf(pcBuf+szLen,")\n");
+   if (siWinPar(pvHdl,pcBuf)<0 || stMain.stInp.stNum.uiNum08!=77 || stMain.stInp.stNum.uiNum32!=4711 || stMain.stInp.stNum.siNum64!=2) {
+      fprintf(stderr,"Parameter file with %d bytes not parsed correctly (NUM08=%d NUM32=%d NUM64=%d)\n",(int)szLen,
+              (int)stMain.stInp.stNum.uiNum08,(int)stMain.stInp.stNum.uiNum32,(int)stMain.stInp.stNum.siNum64); siErr=1;
+   }
+
+   vdClpReset(pvHdl,&stMain,&stErr);
+   szLen=szWinPad(pcBuf,sprintf(pcBuf,"NUM(\n"),2*65536+100);
+   szErr=szLen+sprintf(pcBuf+szLen,"\n   NUM08=77 ");
+   strcat(pcBuf+szLen,"NUM77=1)\n");
+   for (siRow=1,pcHlp=pcBuf;(pcHlp=strchr(pcHlp,'\n'))!=NULL && (size_t)(pcHlp-pcBuf)<szErr;pcHlp++,siRow++);
+   siCol=13;
+   if (siWinPar(pvHdl,pcBuf)>=0 || stErr.piRow==NULL || stErr.piCol==NULL || stErr.ppSrc==NULL || *stErr.piRow!=siRow || *stErr.piCol!=siCol ||
+       *stErr.ppSrc==NULL || strstr(*stErr.ppSrc,"clptst.par")==NULL) {
+      fprintf(stderr,"Position of error in parameter file not correct (Row=%d Column=%d expected %d/%d)\n",
+              (stErr.piRow!=NULL)?*stErr.piRow:-1,(stErr.piCol!=NULL)?*stErr.piCol:-1,siRow,siCol); siErr=1;
+   }
+   remove("clptst.par");
+
+   szLen=szWinPad(pcBuf,sprintf(pcBuf,"\n"),65536-2);
+   szLen+=sprintf(pcBuf+szLen,"DUMMY=4711");
+   szLen=szWinPad(pcBuf,szLen,2*65536);
+   if ((i=siWinExe(pcBuf))!=4711) {
+      fprintf(stderr,"Parameter file with %d bytes not parsed correctly by CLE (DUMMY=%d)\n",(int)szLen,i); siErr=1;
+   }
+
+   vdClpReset(pvHdl,&stMain,&stErr);
+   if (setenv("CLPTST_ONE","1",1)) {
+      fprintf(stderr,"Set of environment variable for window test failed\n"); siErr=1;
+   } else {
+      szLen=sprintf(pcCmd,"LOG(DUMMY=<CLPTST_ONE>");
+      for (i=1;i<300;i++) szLen+=sprintf(pcCmd+szLen,"+<CLPTST_ONE>");
+      strcpy(pcCmd+szLen,")");
+      for (i=0;i<2;i++) {
+         if (siClpParseCmd(pvHdl,NULL,pcCmd,TRUE,TRUE,NULL,NULL)<0 || stMain.stLog.uiDummy!=300) {
+            fprintf(stderr,"Replacement of 300 environment variables failed in parse %d (DUMMY=%d)\n",i+1,(int)stMain.stLog.uiDummy); siErr=1;
+         }
+      }
+      unsetenv("CLPTST_ONE");
+   }
+   vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+   free(pcBuf);
+   free(pcCmd);
+   return(siTstEnd("WINDOW TEST",siErr));
+}
+
+/******************************************************************************/
+
 int main(int argc, char * argv[])
 {
    int               siCnt,l,i;
@@ -299,6 +986,8 @@ int main(int argc, char * argv[])
    char              acBuf[65536];
    char*             pcLst;
    FILE*             pfPar=fopen("clptst.txt","r");
+   int               isBench=(argc>1 && strcmp(argv[1],"-bench")==0);
+   int               siErr=0;
 
 
    TsMain            stMain;
@@ -332,7 +1021,7 @@ int main(int argc, char * argv[])
             fprintf(stderr,"*** PARSING SUCCESSFULL ***\n");
          }
          acBuf[0] = 0;
-         for (i=1 ; i < argc ; i++) {
+         for (i=1+isBench ; i < argc ; i++) {
             if (strlen(acBuf)+strlen(argv[i])<sizeof(acBuf)-2) {
                strcat(acBuf, argv[i]);
                strcat(acBuf, " ");
@@ -361,6 +1050,14 @@ int main(int argc, char * argv[])
          fflush(stdout);
          fflush(stderr);
          vdClpClose(pvHdl,CLPCLS_MTD_ALL);
+         siErr|=siTestSnapshot();
+         siErr|=siTestHex();
+         if (isBench) siErr|=siTestHexBench();
+         siErr|=siTestCloseBlk();
+         siErr|=siTestAlias();
+         siErr|=siTestConstant();
+         siErr|=siTestPool();
+         siErr|=siTestWindow();
 #ifdef __GEN__
          {
             FILE     *f=fopen("clptst.bin","w");
@@ -392,5 +1089,5 @@ int main(int argc, char * argv[])
          printf("*** Output ***\n");
       } else fprintf(stderr,"*** Open CLP failed ***\n");
    } else fprintf(stderr,"*** Open clptst.txt failed ***\n");
-   return(0);
+   return((siErr)?1:0);
 }
@@ -46,6 +46,10 @@
 #  include <dlfcn.h>
 #  include <sys/utsname.h>
 #endif
+#ifdef __UNIX__
+#  include <sys/stat.h>
+#  include <pthread.h>
+#endif
 
 /* Include eigener Bibliotheken  **************************************/
 
@@ -59,6 +63,7 @@
 #  undef  pcSysError
 #  define pcSysError strerror
 #endif
+#define __CLEALC__
 #include "CLEPUTL.h"
 #include "FLAMCLP.h"
 
@@ -169,11 +174,13 @@
  * 1.4.89: Support environment variables CLE_MAX/MIN_CC
  * 1.4.90: Fix handling of owner and MAX/MINCC (make it independent of default command)
  * 1.4.91: Use always stdout for pfStd
+ * 1.4.92: Route dynamic memory through the allocator of CLEPUTL (cle_setalc())
+ * 1.4.93: Keep a snapshot of the parsed property file per command (keyed by file name, size and modification time) to parse it only once per process
  */
-#define CLE_VSN_STR       "1.4.91"
+#define CLE_VSN_STR       "1.4.93"
 #define CLE_VSN_MAJOR      1
 #define CLE_VSN_MINOR        4
-#define CLE_VSN_REVISION       91
+#define CLE_VSN_REVISION       93
 
 /* Definition der Konstanten ******************************************/
 
@@ -279,6 +286,47 @@ typedef struct CleDocPar {
    const char*                   pcEnv;
 }TsCleDocPar;
 
+/* Snapshots of parsed property files (see pvClpSnapPro()) per command. If the property file of a command is
+ * not changed (same name, size, modification and change time in nanoseconds, device and inode) the properties
+ * are set from the snapshot for each further execution of the command in this process without reading and
+ * parsing the file again. The cache is only used with the built-in file reader and the process allocator.*/
+typedef struct ClePsk {
+   I64                           siSiz;
+   I64                           siMts;
+   I64                           siMns;
+   I64                           siCts;
+   I64                           siCns;
+   I64                           siDev;
+   I64                           siIno;
+}TsClePsk;
+
+#ifdef __UNIX__
+#  if defined(__GLIBC__) && !defined(__USE_XOPEN2K8)
+#     define CLESTA_MNS(s)      ((s).st_mtimensec)
+#     define CLESTA_CNS(s)      ((s).st_ctimensec)
+#  elif defined(__APPLE__)
+#     define CLESTA_MNS(s)      ((s).st_mtimespec.tv_nsec)
+#     define CLESTA_CNS(s)      ((s).st_ctimespec.tv_nsec)
+#  else
+#     define CLESTA_MNS(s)      ((s).st_mtim.tv_nsec)
+#     define CLESTA_CNS(s)      ((s).st_ctim.tv_nsec)
+#  endif
+#endif
+
+#ifdef __UNIX__
+typedef struct ClePsn {
+   struct ClePsn*                psNxt;
+   const TsClpArgument*          psTab;
+   char*                         pcKey;
+   char*                         pcFil;
+   TsClePsk                      stPsk;
+   void*                         pvSnp;
+}TsClePsn;
+
+static TsClePsn*                 psClePsnLst=NULL;
+static pthread_mutex_t           stClePsnMtx=PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /* Deklaration der internen Funktionen ********************************/
 
 static int siClePropertyInit(
@@ -487,6 +535,15 @@ static void vdPrnProperties(
    const char*                   pcPat,
    const int                     siDep);
 
+static int siCleGetPropertyFile(
+   FILE*                         pfErr,
+   TsCnfHdl*                     psCnf,
+   const char*                   pcOwn,
+   const char*                   pcPgm,
+   const char*                   pcCmd,
+   char**                        ppFil,
+   int*                          piFlg);
+
 static int siCleGetProperties(
    FILE*                         pfErr,
    TsCnfHdl*                     psCnf,
@@ -500,6 +557,20 @@ static int siCleGetProperties(
    void*                         pvF2S,
    TfF2S*                        pfF2S);
 
+static int siClePropertySnapGet(
+   void*                         pvHdl,
+   const TsClpArgument*          psTab,
+   const char*                   pcKey,
+   const char*                   pcFil,
+   TsClePsk*                     psPsk);
+
+static void vdClePropertySnapPut(
+   void*                         pvHdl,
+   const TsClpArgument*          psTab,
+   const char*                   pcKey,
+   const char*                   pcFil,
+   const TsClePsk*               psPsk);
+
 static int siCleGetCommand(
    FILE*                         pfOut,
    FILE*                         pfErr,
@@ -1018,7 +1089,7 @@ static int siClePrintPropRemain(FILE* pfErr, FILE* pfDoc, const TsCleDoc* psDoc,
       void* pvHdl=NULL;
       siErr=siClePropertyInit(NULL,psCmd[j].pfIni,psCmd[j].pvClp,pcOwn,pcPgm,pcBld,psCmd[j].pcKyw,psCmd[j].pcMan,psCmd[j].pcHlp,
                               psCmd[j].piOid,psCmd[j].psTab,isCas,isPfl,isRpl,siMkl,NULL,pfErr,NULL,
-                              pcDep,pcOpt,pcEnt,(TsCnfHdl*)pvCnf,&pvHdl,NULL,NULL,NULL,NULL,siClpFile2String,NULL,NULL);
+                              pcDep,pcOpt,pcEnt,(TsCnfHdl*)pvCnf,&pvHdl,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
       if (siErr) {
          return(siErr);
       }
@@ -1039,7 +1110,7 @@ static int siClePrintPropDefaults(FILE* pfErr, FILE* pfDoc, const TsCleDoc* psDo
       void* pvHdl=NULL;
       siErr=siClePropertyInit(NULL,psCmd[j].pfIni,psCmd[j].pvClp,pcOwn,pcPgm,pcBld,psCmd[j].pcKyw,psCmd[j].pcMan,psCmd[j].pcHlp,
             psCmd[j].piOid,psCmd[j].psTab,isCas,isPfl,isRpl,siMkl,NULL,pfErr,NULL,
-            pcDep,pcOpt,pcEnt,(TsCnfHdl*)pvCnf,&pvHdl,NULL,NULL,NULL,NULL,siClpFile2String,NULL,NULL);
+            pcDep,pcOpt,pcEnt,(TsCnfHdl*)pvCnf,&pvHdl,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
       if (siErr) {
          return(siErr);
       }
@@ -1337,6 +1408,8 @@ CLPENVTAB_OPN(asCleEnvVarTab) = {
    CLPENVTAB_ENTRY("CLP_STRING_CCSID"     ,CLPFLG_NON,NULL           ,NULL,NULL,"CCSID used for interpretation of critical punctuation character on EBCDIC systems (default is taken from LANG)")
    CLPENVTAB_ENTRY("CLP_DEFAULT_DCB"      ,CLPFLG_NON,NULL           ,NULL,NULL,"The default record format and record length in C file mode format (default is 'recfm=VB, lrecl=516' only for z/OS)")
    CLPENVTAB_ENTRY("CLP_SYMTAB_STATISTICS",CLPFLG_SEL,asCleYesOnNoOff,NULL,NULL,"Print symbol table statistics to STDERR stream at close (must set to YES or ON)")
+   CLPENVTAB_ENTRY("CLP_SYMTAB_IMAGE"     ,CLPFLG_NON,NULL           ,NULL,NULL,"Directory for precompiled symbol table images to speed up the open of the command line parser (rebuilt if stale)")
+   CLPENVTAB_ENTRY("CLP_SYMTAB_SHARED"    ,CLPFLG_SEL,asCleYesOnNoOff,NULL,NULL,"Share the fully built symbol table between handles opened for the same command in one process (must set to YES or ON)")
    CLPENVTAB_ENTRY("CLP_MALLOC_STATISTICS",CLPFLG_SEL,asCleYesOnNoOff,NULL,NULL,"Print memory allocation statistics to STDERR stream at close (must set to YES or ON)")
    CLPENVTAB_CLS
 };
@@ -1532,11 +1605,6 @@ extern int siCleExecute(
       }
    }
 
-   if (pfF2S==NULL) {
-      pvF2S=NULL;
-      pfF2S=siClpFile2String;
-   }
-
    if (pfEnv!=NULL) {
       siErr = pfEnv(pfOut,pfErr);
       if (siErr<0) { return(-1*siErr); }
@@ -3575,6 +3643,8 @@ static int siCleCommandInit(
    clock_t                       ckCpu1=clock();
    clock_t                       ckCpu2;
    char                          acTs[24];
+   char                          acKey[strlen(pcOwn)+strlen(pcPgm)+strlen(pcCmd)+16];
+   TsClePsk                      stPsk={-1,0,0};
 
    *ppHdl=pvClpOpen(isCas,isPfl,isRpl,siMkl,pcOwn,pcPgm,pcBld,pcCmd,pcMan,pcHlp,piOid!=NULL,psTab,pvClp,pfOut,pfErr,pfTrc,pfTrc,pfTrc,pfTrc,pcDep,pcOpt,pcEnt,NULL,pvGbl,pvF2S,pfF2S,pvSaf,pfSaf);
    if (*ppHdl==NULL) {
@@ -3608,6 +3678,21 @@ static int siCleCommandInit(
       fprintf(pfTrc,"%s Initialization of CLP structure for command '%s' was successful (CPU time %7.5fs)\n",cstime(0,acTs),pcCmd,((double)(ckCpu2-ckCpu1))/CLOCKS_PER_SEC);
       ckCpu1=ckCpu2;
    }
+   siErr=siCleGetPropertyFile(pfErr,psCnf,pcOwn,pcPgm,pcCmd,&pcFil,&siFil);
+   if (siErr) {
+      vdClpClose(*ppHdl,CLPCLS_MTD_ALL);*ppHdl=NULL;
+      SAFE_FREE(pcFil);
+      return(siErr);
+   }
+   snprintf(acKey,sizeof(acKey),"%d.%s.%s.%s",isCas,pcOwn,pcPgm,pcCmd);
+   if (pcFil!=NULL && (pfF2S==NULL || pfF2S==siClpFile2String) && siClePropertySnapGet(*ppHdl,psTab,acKey,pcFil,&stPsk)) {
+      if (pfTrc!=NULL) {
+         ckCpu2=clock();
+         fprintf(pfTrc,"%s Properties for command '%s' set from snapshot of unchanged property file '%s' (CPU time %7.5fs)\n",cstime(0,acTs),pcCmd,pcFil,((double)(ckCpu2-ckCpu1))/CLOCKS_PER_SEC);
+      }
+      SAFE_FREE(pcFil);
+      return(CLERTC_OK);
+   }
    siErr=siCleGetProperties(pfErr,psCnf,pcOwn,pcPgm,pcCmd,&pcFil,&pcPro,&siFil,pvGbl,pvF2S,pfF2S);
    if (siErr) {
       vdClpClose(*ppHdl,CLPCLS_MTD_ALL);*ppHdl=NULL;
@@ -3628,6 +3713,7 @@ static int siCleCommandInit(
          return(CLERTC_SYN);
       }
       free(pcPro);
+      vdClePropertySnapPut(*ppHdl,psTab,acKey,pcFil,&stPsk);
       if (pfTrc!=NULL) {
          ckCpu2=clock();
          fprintf(pfTrc,"%s Parsing of properties for command '%s' was successful (CPU time %7.5fs)\n",cstime(0,acTs),pcCmd,((double)(ckCpu2-ckCpu1))/CLOCKS_PER_SEC);
@@ -4100,23 +4186,17 @@ static void vdPrnProperties(
    siClpProperties(pvHdl,CLPPRO_MTD_SET,siDep,pcPat,NULL);
 }
 
-static int siCleGetProperties(
+static int siCleGetPropertyFile(
    FILE*                   pfErr,
    TsCnfHdl*               psCnf,
    const char*             pcOwn,
    const char*             pcPgm,
    const char*             pcCmd,
    char**                  ppFil,
-   char**                  ppPro,
-   int*                    piFlg,
-   void*                   pvGbl,
-   void*                   pvF2S,
-   TfF2S*                  pfF2S)
+   int*                    piFlg)
 {
-   int                     siErr,siSiz=0;
    const char*             pcHlp=NULL;
    char                    acRoot[strlen(pcOwn)+strlen(pcPgm)+strlen(pcCmd)+17];
-   char                    acMsg[1024]="";
 
    SAFE_FREE(*ppFil);
    snprintf(acRoot,sizeof(acRoot),"%s.%s.%s.property.file",pcOwn,pcPgm,pcCmd);
@@ -4138,6 +4218,33 @@ static int siCleGetProperties(
       if (pfErr!=NULL) { fprintf(pfErr,"Allocation of memory for property file name (%s) failed)\n",pcHlp); }
       return(CLERTC_MEM);
    }
+   return(CLERTC_OK);
+}
+
+static int siCleGetProperties(
+   FILE*                   pfErr,
+   TsCnfHdl*               psCnf,
+   const char*             pcOwn,
+   const char*             pcPgm,
+   const char*             pcCmd,
+   char**                  ppFil,
+   char**                  ppPro,
+   int*                    piFlg,
+   void*                   pvGbl,
+   void*                   pvF2S,
+   TfF2S*                  pfF2S)
+{
+   int                     siErr,siSiz=0;
+   char                    acMsg[1024]="";
+
+   if (pfF2S==NULL) {
+      pvF2S=NULL;
+      pfF2S=siClpFile2String;
+   }
+   siErr=siCleGetPropertyFile(pfErr,psCnf,pcOwn,pcPgm,pcCmd,ppFil,piFlg);
+   if (siErr || *ppFil==NULL) {
+      return(siErr);
+   }
    siErr=pfF2S(pvGbl,pvF2S,*ppFil,ppPro,&siSiz,acMsg,sizeof(acMsg));
    if (siErr<0) {
       if (pfErr!=NULL) { fprintf(pfErr,"Property file: %s\n",acMsg); }
@@ -4148,6 +4255,104 @@ static int siCleGetProperties(
    return(CLERTC_OK);
 }
 
+static int siClePropertySnapGet(
+   void*                   pvHdl,
+   const TsClpArgument*    psTab,
+   const char*             pcKey,
+   const char*             pcFil,
+   TsClePsk*               psPsk)
+{
+#ifdef __UNIX__
+   struct stat             stSta;
+   TsClePsn*               psPsn;
+   TsClePsn**              ppPsn;
+   int                     siCnt=-1;
+
+   memset(psPsk,0,sizeof(TsClePsk));
+   if (cle_thdalc() || stat(pcFil,&stSta) || !S_ISREG(stSta.st_mode)) {
+      psPsk->siSiz=-1;
+      return(FALSE);
+   }
+   psPsk->siSiz=stSta.st_size;
+   psPsk->siMts=stSta.st_mtime;
+   psPsk->siMns=CLESTA_MNS(stSta);
+   psPsk->siCts=stSta.st_ctime;
+   psPsk->siCns=CLESTA_CNS(stSta);
+   psPsk->siDev=stSta.st_dev;
+   psPsk->siIno=stSta.st_ino;
+   pthread_mutex_lock(&stClePsnMtx);
+   for (ppPsn=&psClePsnLst;(psPsn=*ppPsn)!=NULL;ppPsn=&psPsn->psNxt) {
+      if (psPsn->psTab==psTab && strcmp(psPsn->pcKey,pcKey)==0 && strcmp(psPsn->pcFil,pcFil)==0) break;
+   }
+   if (psPsn!=NULL) {
+      if (memcmp(&psPsn->stPsk,psPsk,sizeof(TsClePsk))==0) {
+         siCnt=siClpApplyPro(pvHdl,psPsn->pvSnp,FALSE);
+      }
+      if (siCnt<0) { // property file changed or snapshot not applicable, the file is parsed again
+         *ppPsn=psPsn->psNxt;
+         vdClpFreePro(psPsn->pvSnp);
+         free(psPsn->pcKey);
+         free(psPsn->pcFil);
+         free(psPsn);
+      }
+   }
+   pthread_mutex_unlock(&stClePsnMtx);
+   return(siCnt>=0);
+#else
+   (void)pvHdl; (void)psTab; (void)pcKey; (void)pcFil;
+   psPsk->siSiz=-1;
+   return(FALSE);
+#endif
+}
+
+static void vdClePropertySnapPut(
+   void*                   pvHdl,
+   const TsClpArgument*    psTab,
+   const char*             pcKey,
+   const char*             pcFil,
+   const TsClePsk*         psPsk)
+{
+#ifdef __UNIX__
+   TsClePsn*               psPsn;
+   TsClePsn*               psHlp;
+
+   if (psPsk->siSiz<0 || cle_thdalc()) return;
+   psPsn=(TsClePsn*)calloc(1,sizeof(TsClePsn));
+   if (psPsn==NULL) return;
+   psPsn->pcKey=malloc(strlen(pcKey)+1);
+   psPsn->pcFil=malloc(strlen(pcFil)+1);
+   psPsn->pvSnp=pvClpSnapPro(pvHdl);
+   if (psPsn->pcKey==NULL || psPsn->pcFil==NULL || psPsn->pvSnp==NULL) {
+      vdClpFreePro(psPsn->pvSnp);
+      SAFE_FREE(psPsn->pcKey);
+      SAFE_FREE(psPsn->pcFil);
+      free(psPsn);
+      return;
+   }
+   strcpy(psPsn->pcKey,pcKey);
+   strcpy(psPsn->pcFil,pcFil);
+   psPsn->psTab=psTab;
+   psPsn->stPsk=*psPsk;
+   pthread_mutex_lock(&stClePsnMtx);
+   for (psHlp=psClePsnLst;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (psHlp->psTab==psTab && strcmp(psHlp->pcKey,pcKey)==0 && strcmp(psHlp->pcFil,pcFil)==0) break;
+   }
+   if (psHlp==NULL) {
+      psPsn->psNxt=psClePsnLst;
+      psClePsnLst=psPsn;
+   }
+   pthread_mutex_unlock(&stClePsnMtx);
+   if (psHlp!=NULL) { // snapshot already registered by another thread
+      vdClpFreePro(psPsn->pvSnp);
+      free(psPsn->pcKey);
+      free(psPsn->pcFil);
+      free(psPsn);
+   }
+#else
+   (void)pvHdl; (void)psTab; (void)pcKey; (void)pcFil; (void)psPsk;
+#endif
+}
+
 static int siCleGetCommand(
    FILE*                   pfOut,
    FILE*                   pfErr,
@@ -4165,6 +4370,10 @@ static int siCleGetCommand(
 {
    int                     siErr,siSiz=0;
    int                     l=strlen(pcFct);
+   if (pfF2S==NULL) {
+      pvF2S=NULL;
+      pfF2S=siClpFile2String;
+   }
    SAFE_FREE(*ppFil);
    if (argv[1][l]==EOS) {
       if (argc>2) {
@@ -40,6 +40,17 @@
 #include <locale.h>
 #include <limits.h>
 #include <math.h>
+#ifdef __UNIX__
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <pthread.h>
+#endif
+#if (defined(__AVX2__) || defined(__SSE2__)) && defined(__GNUC__) && !defined(__EBCDIC__) && !defined(__CLPNOSIMD__)
+#  include <immintrin.h>
+#  define __CLPSIMD__
+#endif
 
 #ifdef __FL5__
 //#  define __HEAP_STATISTIC__
@@ -69,6 +80,7 @@
 #  undef  flrand
 #  define flrand     rand
 #endif
+#define __CLEALC__
 #include "CLEPUTL.h"
 /* Include der Schnittstelle ******************************************/
 #include "FLAMCLP.h"
@@ -218,20 +230,41 @@
  * 1.4.141: Support hidden flag also for aliases
  * 1.4.142: Rework internal function to typed handle parameter (psHdl instead of pvHdl)
  * 1.5.143: Rework symbol table to allocate only used portions
+ * 1.5.144: Allocate symbol table records from a per handle arena (block list) and release them in one step
+ * 1.5.145: Use a sorted keyword index per table to find symbols by binary search instead of linear compare (keys carry the first 8 bytes as integer and the required keyword length)
+ * 1.5.146: Support precompiled symbol table images (envar 'CLP_SYMTAB_IMAGE') mapped and relocated at open instead of rebuilt
+ * 1.5.147: Share immutable symbol tables between handles (envar 'CLP_SYMTAB_SHARED') with per handle values and properties
+ * 1.5.148: Hot symbol fields in a contiguous array per table not adopted (no measurable gain, revision kept)
+ * 1.5.149: Resolve links and compute required keyword lengths with the sorted keyword index instead of pairwise compares
+ * 1.5.150: Remove limit of CLPMAX_TABCNT entries per table and save values on a reusable stack per handle sized to the table
+ * 1.5.151: Build tables of selections and constants on first reference like objects and overlays (all tables still built with envar CLP_FULL_SYMTAB)
+ * 1.5.152: Find the slot of an allocated pointer with a hash index and grow the slot table geometrically
+ * 1.5.153: Grow dynamic memory geometrically with a capacity behind the size and wipe moved password memory
+ * 1.5.154: Route dynamic memory through the allocator of CLEPUTL (cle_setalc()) and build private symbol tables for thread allocators
+ * 1.5.155: Add pvClpCloseBlk() to transfer all dynamic memory of the CLP structure in one block
+ * 1.5.156: Scan literals and keywords as slices of the input and hand over the lexeme to the value buffer without copy
+ * 1.5.157: Replace environment variables in place in one buffer per input level (linear and without limit of 256 replacements)
+ * 1.5.158: Find built-in constants with a case insensitive perfect hash and support application specific constants (siClpConstant)
+ * 1.5.159: Skip separators, comments and string literals in blocks with SSE2/AVX2 if available (define __CLPNOSIMD__ for the byte loop)
+ * 1.5.160: Read parameter files in chunks through a bounded window instead of loading and un-escaping the whole file
+ * 1.5.161: Scan command and property strings in place if they contain nothing to un-escape, else copy only once behind the unchanged prefix
+ * 1.5.162: Use the cached tables of dia-critical characters for un-escaping
+ * 1.5.163: Convert number literals by direct accumulation and floating point literals independent of the locale
+ * 1.5.164: Grow the lexeme buffer geometrically, append to the parsed list without strlen() and reuse the buffers of closed handles per thread
+ * 1.5.165: Compile defaults and properties once per handle into a list of literals and replay them as long as the property is not changed
+ * 1.5.166: Support snapshots of parsed properties (pvClpSnapPro(), siClpApplyPro(), vdClpFreePro()) to set them without parsing again
 **/
 
-#define CLP_VSN_STR       "1.5.143"
+#define CLP_VSN_STR       "1.5.166"
 #define CLP_VSN_MAJOR      1
 #define CLP_VSN_MINOR        5
-#define CLP_VSN_REVISION       143
+#define CLP_VSN_REVISION       166
 
 /* Definition der Konstanten ******************************************/
 
-#define CLPMAX_TABCNT            512
 #define CLPMAX_HDEPTH            128
 #define CLPMAX_KYWLEN            63
 #define CLPMAX_KYWSIZ            64
-#define CLPMAX_BUFCNT            256
 
 #define CLPINI_LEXSIZ            1024
 #define CLPINI_LSTSIZ            1024
@@ -240,7 +273,24 @@
 #define CLPINI_PRESIZ            1024
 #define CLPINI_PATSIZ            1024
 #define CLPINI_VALSIZ            128
+#define CLPPOL_CNT               4
+#define CLPPOL_BUF               6
+#define CLPPOL_MAX               0x100000
 #define CLPINI_PTRCNT            128
+#define CLPINI_PIXCNT            256
+#define CLPINI_VARCNT            128
+#define CLPINI_SAVCNT            256
+#define CLPINI_BUFCNT            8
+#define CLPINI_CONCNT            16
+#define CLPINI_CSLCNT            64
+#define CLPINI_BLKSIZ            32768
+#define CLPINI_STMSIZ            65536
+#define CLPINI_BLKALN            16
+
+#define CLPIMG_MAGIC             "FLCLPIMG"
+#define CLPIMG_RELINT            1
+#define CLPIMG_RELARG            2
+#define CLPIMG_FLDCNT            10
 
 #define CLPTOK_INI               0
 #define CLPTOK_END               1
@@ -351,10 +401,8 @@ typedef struct Std {
 }TsStd;
 
 typedef struct Fix {
-   const char*                   pcDft;
    const char*                   pcMan;
    const char*                   pcHlp;
-   char*                         pcPro;
    int                           siTyp;
    int                           siMin;
    int                           siMax;
@@ -368,8 +416,6 @@ typedef struct Fix {
    struct Sym*                   psEln;
    struct Sym*                   psSln;
    struct Sym*                   psTln;
-   char*                         pcSrc;
-   int                           siRow;
 }TsFix;
 
 typedef struct Var {
@@ -381,6 +427,69 @@ typedef struct Var {
    int                           siInd;
 }TsVar;
 
+typedef struct Pro {
+   const char*                   pcDft;
+   char*                         pcPro;
+   char*                         pcSrc;
+   int                           siRow;
+   unsigned int                  uiFlg;
+}TsPro;
+
+/* The values of a default / property of a number, float or string argument are compiled at the first use
+ * into a list of literals (the lexemes for siClpBldLit() with the scanner position for error messages) and
+ * replayed as long as the property is not changed. A default with values which can differ from parse to
+ * parse (environment variables, relative times, dynamic constants, values of other arguments or string
+ * files) is marked as dynamic and parsed each time.*/
+typedef struct Dfv {
+   size_t                        siOfs;
+   int                           siRow;
+   int                           siRwo;
+   int                           siOld;
+   int                           siCur;
+}TsDfv;
+
+typedef struct Dfc {
+   const char*                   pcDft;
+   int                           isDyn;
+   int                           siVal;
+   int                           szVal;
+   TsDfv*                        psVal;
+   size_t                        szBuf;
+   size_t                        siBuf;
+   char*                         pcBuf;
+}TsDfc;
+
+/* A snapshot of the properties of a handle contains for each property set in the handle the path, the
+ * property string, the source and the row. It can be applied to another handle of the same command
+ * without scanning and parsing the property list again.*/
+typedef struct Sne {
+   char*                         pcPat;
+   char*                         pcPro;
+   char*                         pcSrc;
+   int                           siRow;
+}TsSne;
+
+typedef struct Snp {
+   int                           siCnt;
+   int                           szEnt;
+   TsSne*                        psEnt;
+}TsSnp;
+
+typedef struct Kyx {
+   U64                           uiPfx;
+   const char*                   pcKey;
+   struct Sym*                   psSym;
+   int                           siPos;
+   int                           siElm;
+   int                           siKwl;
+}TsKyx;
+
+typedef struct Idx {
+   int                           siCnt;
+   int                           siEnt;
+   TsKyx                         asKyx[];
+}TsIdx;
+
 typedef struct Sym {
    const TsClpArgument*          psArg;
    const TsClpArgument*          psTab;
@@ -390,15 +499,156 @@ typedef struct Sym {
    struct Sym*                   psHih;
    TsStd*                        psStd;
    TsFix*                        psFix;
-   TsVar*                        psVar;
+   const TsIdx*                  psIdx;
+   int                           siPos;
+   int                           siVar;
+   int                           siSid;
 }TsSym;
 
 typedef struct Ptr {
    void*                         pvPtr;
    int                           siSiz;
+   int                           siCap;
    unsigned int                  uiFlg;
+   int                           isTmp;
+   int                           siPar;
+   int                           siOfs;
+   void**                        ppRef;
 } TsPtr;
 
+typedef struct Con {
+   const char*                   pcKyw;
+   int                           siTyp;
+   int                           siKnd;
+   I64                           siNum;
+   F64                           flNum;
+   const char*                   pcStr;
+} TsCon;
+
+typedef struct Stm {
+   struct Stm*                   psNxt;
+   FILE*                         pfFil;
+   int                           siBuf;
+   int                           isEof;
+   size_t                        szRaw;
+   size_t                        siRaw;
+   char*                         pcRaw;
+   const char*                   pcEnd;
+   const char*                   pcRcl;
+   size_t                        szRow;
+   TsDiaChr                      stDia;
+} TsStm;
+
+#define CLPCON_NUM               1
+#define CLPCON_NOW               2
+#define CLPCON_RND               3
+#define CLPCON_FLT               4
+#define CLPCON_STR               5
+#define CLPCON_LCT               6
+#define CLPCON_GMT               7
+#define CLPCON_LOF               8
+#define CLPCON_LOA               9
+#define CLPCON_GOF               10
+#define CLPCON_GOA               11
+#define CLPCON_R10               12
+#define CLPCON_R16               13
+
+typedef struct Blk {
+   struct Blk*                   psNxt;
+   size_t                        szBlk;
+   size_t                        szUsd;
+} TsBlk;
+
+#define CLPBLK_HDRSIZ            ((sizeof(TsBlk)+CLPINI_BLKALN-1)&~((size_t)CLPINI_BLKALN-1))
+
+typedef struct Img {
+   char                          acMag[8];
+   U64                           uiHsh;
+   U64                           szDat;
+   U64                           siRel;
+   U64                           uiTab;
+   U64                           siSym;
+   U64                           siVar;
+} TsImg;
+
+#define CLPIMG_HDRSIZ            ((sizeof(TsImg)+CLPINI_BLKALN-1)&~((size_t)CLPINI_BLKALN-1))
+
+typedef struct Rel {
+   U64                           uiOfs;
+   U64                           uiVal;
+   U32                           uiKnd;
+   U32                           uiFld;
+} TsRel;
+
+typedef struct Map {
+   const void*                   pvPtr;
+   U32                           uiOrd;
+   U32                           uiFld;
+} TsMap;
+
+typedef struct Imc {
+   U64                           uiHsh;
+   int                           siTab;
+   int                           szTab;
+   const TsClpArgument**         ppTab;
+   int                           siEnt;
+   int                           szEnt;
+   const TsClpArgument**         ppEnt;
+} TsImc;
+
+typedef struct Ims {
+   const TsImc*                  psImc;
+   int                           siBlk;
+   TsBlk**                       ppBlk;
+   U64*                          piOfs;
+   U64                           szDat;
+   char*                         pcDat;
+   int                           siMap;
+   TsMap*                        psMap;
+   U64                           siRel;
+   U64                           szRel;
+   TsRel*                        psRel;
+} TsIms;
+
+
+typedef struct Tpl {
+   struct Tpl*                   psNxt;
+   const TsClpArgument*          psArg;
+   char*                         pcKey;
+   int                           isShr;
+   int                           siRef;
+   TsSym*                        psTab;
+   TsBlk*                        psBlk;
+   void*                         pvImg;
+   size_t                        szImg;
+   long                          siSym;
+   int                           siVar;
+   int                           szVar;
+   TsVar*                        psVar;
+   TsPro*                        psPro;
+} TsTpl;
+
+static TsTpl*                    psClpTplLst=NULL;
+#ifdef __UNIX__
+static pthread_mutex_t           stClpTplMtx=PTHREAD_MUTEX_INITIALIZER;
+#  define CLPTPL_LOCK()          pthread_mutex_lock(&stClpTplMtx)
+#  define CLPTPL_UNLOCK()        pthread_mutex_unlock(&stClpTplMtx)
+#endif
+
+typedef struct Pol {
+   TsCleAlc                      stAlc;
+   int                           siCnt;
+   TsCleAlc                      asAlc[CLPPOL_CNT];
+   char*                         apBuf[CLPPOL_CNT][CLPPOL_BUF];
+   size_t                        azBuf[CLPPOL_CNT][CLPPOL_BUF];
+} TsPol;
+
+#ifdef __UNIX__
+static pthread_key_t             stClpPolKey;
+static pthread_once_t            stClpPolOnc=PTHREAD_ONCE_INIT;
+static int                       isClpPolKey=FALSE;
+#endif
+
 typedef struct ParamDescriptor {
    const char*                   pcAnchorPrefix;
    const char*                   pcCommand;
@@ -407,6 +657,64 @@ typedef struct ParamDescriptor {
 } TsParamDescription;
 static const TsParamDescription stDefaultParamDesc = { "", "" ,"", "" };
 
+static const TsCon asClpCon[]={
+   {"NOW"     ,CLPTYP_NUMBER,CLPCON_NOW,0                                         ,0.0          ,NULL},
+   {"MINUTE"  ,CLPTYP_NUMBER,CLPCON_NUM,60                                        ,0.0          ,NULL},
+   {"HOUR"    ,CLPTYP_NUMBER,CLPCON_NUM,60*60                                     ,0.0          ,NULL},
+   {"DAY"     ,CLPTYP_NUMBER,CLPCON_NUM,24*60*60                                  ,0.0          ,NULL},
+   {"YEAR"    ,CLPTYP_NUMBER,CLPCON_NUM,365*24*60*60                              ,0.0          ,NULL},
+   {"KiB"     ,CLPTYP_NUMBER,CLPCON_NUM,((I64)1024)                               ,0.0          ,NULL},
+   {"MiB"     ,CLPTYP_NUMBER,CLPCON_NUM,((I64)1024)*1024                          ,0.0          ,NULL},
+   {"GiB"     ,CLPTYP_NUMBER,CLPCON_NUM,((I64)1024)*1024*1024                     ,0.0          ,NULL},
+   {"TiB"     ,CLPTYP_NUMBER,CLPCON_NUM,((I64)1024)*1024*1024*1024                ,0.0          ,NULL},
+   {"RND8"    ,CLPTYP_NUMBER,CLPCON_RND,8                                         ,0.0          ,NULL},
+   {"RND4"    ,CLPTYP_NUMBER,CLPCON_RND,4                                         ,0.0          ,NULL},
+   {"RND2"    ,CLPTYP_NUMBER,CLPCON_RND,2                                         ,0.0          ,NULL},
+   {"RND1"    ,CLPTYP_NUMBER,CLPCON_RND,1                                         ,0.0          ,NULL},
+   {"PI"      ,CLPTYP_FLOATN,CLPCON_FLT,0                                         ,3.14159265359,NULL},
+   {"LCSTAMP" ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%Y%m%d.%H%M%S"},
+   {"LCDATE"  ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%Y%m%d"},
+   {"LCYEAR"  ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%Y"},
+   {"LCYEAR2" ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%y"},
+   {"LCMONTH" ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%m"},
+   {"LCDAY"   ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%d"},
+   {"LCTIME"  ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%H%M%S"},
+   {"LCHOUR"  ,CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%H"},
+   {"LCMINUTE",CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%M"},
+   {"LCSECOND",CLPTYP_STRING,CLPCON_LCT,0                                         ,0.0          ,"d'%S"},
+   {"LCOFFSET",CLPTYP_STRING,CLPCON_LOF,0                                         ,0.0          ,NULL},
+   {"LCOFFABS",CLPTYP_STRING,CLPCON_LOA,0                                         ,0.0          ,NULL},
+   {"GMSTAMP" ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%Y%m%d.%H%M%S"},
+   {"GMDATE"  ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%Y%m%d"},
+   {"GMYEAR"  ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%Y"},
+   {"GMYEAR2" ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%y"},
+   {"GMMONTH" ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%m"},
+   {"GMDAY"   ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%d"},
+   {"GMTIME"  ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%H%M%S"},
+   {"GMHOUR"  ,CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%H"},
+   {"GMMINUTE",CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%M"},
+   {"GMSECOND",CLPTYP_STRING,CLPCON_GMT,0                                         ,0.0          ,"d'%S"},
+   {"GMOFFSET",CLPTYP_STRING,CLPCON_GOF,0                                         ,0.0          ,NULL},
+   {"GMOFFABS",CLPTYP_STRING,CLPCON_GOA,0                                         ,0.0          ,NULL},
+   {"S1RND10" ,CLPTYP_STRING,CLPCON_R10,1                                         ,0.0          ,NULL},
+   {"S2RND10" ,CLPTYP_STRING,CLPCON_R10,2                                         ,0.0          ,NULL},
+   {"S3RND10" ,CLPTYP_STRING,CLPCON_R10,3                                         ,0.0          ,NULL},
+   {"S4RND10" ,CLPTYP_STRING,CLPCON_R10,4                                         ,0.0          ,NULL},
+   {"S5RND10" ,CLPTYP_STRING,CLPCON_R10,5                                         ,0.0          ,NULL},
+   {"S6RND10" ,CLPTYP_STRING,CLPCON_R10,6                                         ,0.0          ,NULL},
+   {"S7RND10" ,CLPTYP_STRING,CLPCON_R10,7                                         ,0.0          ,NULL},
+   {"S8RND10" ,CLPTYP_STRING,CLPCON_R10,8                                         ,0.0          ,NULL},
+   {"S1RND16" ,CLPTYP_STRING,CLPCON_R16,1                                         ,0.0          ,NULL},
+   {"S2RND16" ,CLPTYP_STRING,CLPCON_R16,2                                         ,0.0          ,NULL},
+   {"S3RND16" ,CLPTYP_STRING,CLPCON_R16,3                                         ,0.0          ,NULL},
+   {"S4RND16" ,CLPTYP_STRING,CLPCON_R16,4                                         ,0.0          ,NULL},
+   {"S5RND16" ,CLPTYP_STRING,CLPCON_R16,5                                         ,0.0          ,NULL},
+   {"S6RND16" ,CLPTYP_STRING,CLPCON_R16,6                                         ,0.0          ,NULL},
+   {"S7RND16" ,CLPTYP_STRING,CLPCON_R16,7                                         ,0.0          ,NULL},
+   {"S8RND16" ,CLPTYP_STRING,CLPCON_R16,8                                         ,0.0          ,NULL}
+};
+#define CLPCON_BLTCNT            ((int)(sizeof(asClpCon)/sizeof(TsCon)))
+
 typedef struct Hdl {
    const char*                   pcOwn;
    const char*                   pcPgm;
@@ -438,6 +746,14 @@ typedef struct Hdl {
    TsSym*                        psTab;
    TsSym*                        psSym;
    TsSym*                        psOld;
+   TsTpl*                        psTpl;
+   int                           siVar;
+   int                           szVar;
+   TsVar*                        psVar;
+   TsPro*                        psPro;
+   TsDfc*                        psDfc;
+   unsigned int*                 puDfl;
+   int                           szDfl;
    void*                         pvDat;
    FILE*                         pfHlp;
    FILE*                         pfErr;
@@ -454,25 +770,42 @@ typedef struct Hdl {
    char*                         pcPat;
    size_t                        szLst;
    char*                         pcLst;
+   size_t                        siLst;
    int                           siBuf;
-   size_t                        pzBuf[CLPMAX_BUFCNT];
-   char*                         apBuf[CLPMAX_BUFCNT];
+   int                           szBuf;
+   size_t*                       pzBuf;
+   char**                        apBuf;
+   size_t                        szInp;
+   TsStm*                        psStm;
    int                           siRow;
    int                           siCol;
    int                           siErr;
    unsigned int                  uiLev;
    I64                           siNow;
    I64                           siRnd;
+   unsigned int                  uiDyn;
    int                           siPtr;
    int                           szPtr;
    TsPtr*                        psPtr;
+   int                           siPix;
+   int                           szPix;
+   int*                          piPix;
+   int                           siSav;
+   int                           szSav;
+   TsVar*                        psSav;
+   int                           siCon;
+   int                           szCon;
+   TsCon*                        psCon;
+   unsigned int                  uiCmk;
+   unsigned int                  uiCbk;
+   unsigned int*                 puCds;
+   int*                          piCsl;
    const TsSym*                  psVal;
    void*                         pvGbl;
    void*                         pvF2s;
    TfF2S*                        pfF2s;
    void*                         pvSaf;
    TfSaf*                        pfSaf;
-   long                          siSym;
    void*                         pvPrn;
    TfClpPrintPage*               pfPrn;
    int                           isMan;
@@ -489,6 +822,23 @@ typedef struct Hdl {
 
 static inline const char* GETALI(const TsSym* sym) { return (sym->psStd->psAli != NULL) ? sym->psStd->psAli->psStd->pcKyw : NULL; }
 static inline const char* GETKYW(const TsSym* sym) { return (sym->psStd->psAli != NULL) ? sym->psStd->psAli->psStd->pcKyw : sym->psStd->pcKyw; }
+static inline TsVar*       GETVAR(const TsHdl* hdl, const TsSym* sym) { return hdl->psVar+sym->siVar; }
+static inline TsPro*       GETPRO(const TsHdl* hdl, const TsSym* sym) { return hdl->psPro+sym->siVar; }
+static inline TsVar*       INIVAR(const TsHdl* hdl, const TsSym* sym) { return hdl->psTpl->psVar+sym->siVar; }
+static inline TsPro*       INIPRO(const TsHdl* hdl, const TsSym* sym) { return hdl->psTpl->psPro+sym->siVar; }
+static inline char*        OWNPRO(const TsHdl* hdl, const TsSym* sym) { return (GETPRO(hdl,sym)->pcPro!=INIPRO(hdl,sym)->pcPro) ? GETPRO(hdl,sym)->pcPro : NULL; }
+static inline char*        OWNSRC(const TsHdl* hdl, const TsSym* sym) { return (GETPRO(hdl,sym)->pcSrc!=INIPRO(hdl,sym)->pcSrc) ? GETPRO(hdl,sym)->pcSrc : NULL; }
+static inline unsigned int GETDFL(const TsHdl* hdl, const TsSym* sym) { return (sym->siSid<hdl->szDfl) ? hdl->puDfl[sym->siSid] : 0; }
+
+/* The input of the application can be scanned in place, so it must not be referenced after the parser returns */
+static inline int siClpInpRel(TsHdl* psHdl, const int siErr)
+{
+   psHdl->pcInp=NULL;
+   psHdl->pcCur=NULL;
+   psHdl->pcOld=NULL;
+   psHdl->pcRow=NULL;
+   return(siErr);
+}
 
 /* Deklaration der internen Funktionen ********************************/
 
@@ -508,12 +858,49 @@ static int siClpSymIni(
    TsSym*                        psHih,
    TsSym**                       ppFst);
 
+static int siClpSymEnv(
+   TsHdl*                        psHdl,
+   const char*                   pcPat,
+   const TsClpArgument*          psArg,
+   TsPro*                        psPro);
+
+static int siClpSymVar(
+   TsHdl*                        psHdl);
+
+static void vdClpSymCon(
+   TsHdl*                        psHdl,
+   const TsSym*                  psSym);
+
+static int siClpVarExt(
+   TsHdl*                        psHdl);
+
+static void vdClpVarDel(
+   TsHdl*                        psHdl);
+
+static void vdClpDfcRst(
+   TsHdl*                        psHdl,
+   const TsSym*                  psArg);
+
+static int siClpSymIdx(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   const TsClpArgument*          psArg,
+   TsSym*                        psTab);
+
+static void vdClpIdxKwl(
+   TsSym*                        psTab);
+
 static int siClpSymCal(
    TsHdl*                        psHdl,
    const int                     siLev,
    const TsSym*                  psArg,
    TsSym*                        psTab);
 
+static int siClpSymKwl(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   TsSym*                        psTab);
+
 static int siClpSymFnd(
    TsHdl*                        psHdl,
    const int                     siLev,
@@ -535,9 +922,66 @@ static void vdClpSymDel(
    uint64_t*                     piCnt,
    uint64_t*                     piSiz);
 
-static char* pcClpUnEscape(
+static void* pvClpSymAlc(
+   TsHdl*                        psHdl,
+   const size_t                  szSiz);
+
+static void vdClpSymRel(
+   TsTpl*                        psTpl,
+   const char*                   pcFnc);
+
+static int siClpTplGet(
+   TsHdl*                        psHdl,
+   const TsClpArgument*          psTab);
+
+static void vdClpTplReg(
+   TsHdl*                        psHdl);
+
+static void vdClpTplRel(
+   TsHdl*                        psHdl,
+   const char*                   pcFnc);
+
+static char* pcClpImgFil(
+   TsHdl*                        psHdl,
+   const TsClpArgument*          psTab,
+   TsImc*                        psImc);
+
+static int siClpImgLod(
+   TsHdl*                        psHdl,
+   const TsImc*                  psImc,
+   const char*                   pcFil);
+
+static void vdClpImgSav(
+   TsHdl*                        psHdl,
+   const TsImc*                  psImc,
+   const char*                   pcFil);
+
+static void vdClpImgDel(
+   TsImc*                        psImc);
+
+static void vdClpImgUnm(
+   char*                         pcImg,
+   const size_t                  szImg);
+
+static const char* pcClpUnEscape(
+   TsHdl*                        psHdl,
+   const char*                   pcInp,
+   const int                     isCpy);
+
+static void vdClpStmFre(
+   TsHdl*                        psHdl,
+   const int                     isAll);
+
+static void vdClpStmRow(
+   TsHdl*                        psHdl);
+
+static int siClpEnvRep(
    TsHdl*                        psHdl,
-   const char*                   pcInp);
+   FILE*                         pfTrc,
+   const char*                   pcBeg,
+   const char*                   pcEnd,
+   const char*                   pcEnv,
+   const char**                  ppCur);
 
 static int siClpScnNat(
    TsHdl*                        psHdl,
@@ -566,6 +1010,14 @@ static int siClpConNat(
    const int                     siTyp,
    const TsSym*                  psArg);
 
+static int siClpConFnd(
+   TsHdl*                        psHdl,
+   const int                     isCas,
+   const char*                   pcKyw);
+
+static void vdClpConFre(
+   TsHdl*                        psHdl);
+
 static int siClpConSrc(
    TsHdl*                        psHdl,
    const int                     isChk,
@@ -722,25 +1174,30 @@ static int siClpBldLit(
    TsSym*                        psArg,
    const char*                   pcVal);
 
+static TsVar* psClpSavPsh(
+   TsHdl*                        psHdl,
+   const int                     siCnt,
+   int*                          piSav);
+
 static int siClpIniMainObj(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   TsVar                         asSav[]);
+   int*                          piSav);
 
 static int siClpFinMainObj(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   const TsVar                   asSav[]);
+   const int                     siSav);
 
 static int siClpIniMainOvl(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   TsVar                         asSav[]);
+   int*                          piSav);
 
 static int siClpFinMainOvl(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   const TsVar                   asSav[],
+   const int                     siSav,
    const int                     siOid);
 
 static int siClpIniObj(
@@ -749,7 +1206,7 @@ static int siClpIniObj(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym**                       ppDep,
-   TsVar                         asSav[]);
+   int*                          piSav);
 
 static int siClpFinObj(
    TsHdl*                        psHdl,
@@ -757,7 +1214,7 @@ static int siClpFinObj(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym*                        psDep,
-   const TsVar                   asSav[]);
+   const int                     siSav);
 
 static int siClpIniOvl(
    TsHdl*                        psHdl,
@@ -765,7 +1222,7 @@ static int siClpIniOvl(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym**                       ppDep,
-   TsVar                         asSav[]);
+   int*                          piSav);
 
 static int siClpFinOvl(
    TsHdl*                        psHdl,
@@ -773,7 +1230,7 @@ static int siClpFinOvl(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym*                        psDep,
-   const TsVar                   asSav[],
+   const int                     siSav,
    const int                     siOid);
 
 static int siClpSetDefault(
@@ -896,6 +1353,9 @@ static inline int CLPERR(TsHdl* psHdl,int siErr, char* pcMsg, ...) {
    psHdl->siErr=siErr;
    if (psHdl->pcRow!=NULL && psHdl->pcOld>=psHdl->pcRow) {
       psHdl->siCol=(int)((psHdl->pcOld-psHdl->pcRow)+1);
+      if (psHdl->psStm!=NULL && psHdl->psStm->siBuf==psHdl->siBuf && psHdl->psStm->pcRcl==psHdl->pcRow) {
+         psHdl->siCol+=(int)psHdl->psStm->szRow;
+      }
    } else psHdl->siCol=0;
    if (psHdl->pfErr!=NULL) {
       fprintf(psHdl->pfErr,"%s:\n%s %s\n",pcErr,fpcPre(psHdl,0),acMsg);
@@ -923,6 +1383,7 @@ static inline int CLPERR(TsHdl* psHdl,int siErr, char* pcMsg, ...) {
          }
          if (psHdl->pcRow!=NULL) {
             int f=FALSE;
+            vdClpStmRow(psHdl);
             fprintf(psHdl->pfErr,"%s \"",fpcPre(psHdl,1));
             for (const char* p=psHdl->pcRow;!iscntrl(*p);p++) { fprintf(psHdl->pfErr,"%c",*p); }
             fprintf(psHdl->pfErr,"\"\n");
@@ -993,6 +1454,61 @@ static inline I64 ClpRndFnv(const I64 siRnd)
    return h;
 }
 
+static inline U64 ClpPixHsh(const void* pvPtr)
+{
+   U64            h=(U64)(uintptr_t)pvPtr;
+   h^=h>>33; h*=0xff51afd7ed558ccdLLU; h^=h>>33;
+   return h;
+}
+
+static inline void vdClpPixIns(
+   TsHdl*                        psHdl,
+   const int                     siInd)
+{
+   U64 m=(U64)(psHdl->szPix-1);
+   U64 h=ClpPixHsh(psHdl->psPtr[siInd].pvPtr)&m;
+   while (psHdl->piPix[h]) { h=(h+1)&m; }
+   psHdl->piPix[h]=siInd+1;
+   psHdl->siPix++;
+}
+
+static int siClpPixAdd( // the index holds slot numbers (+1) at the hash of the pointer, stale entries never match and are dropped by the rebuild
+   TsHdl*                        psHdl,
+   const int                     siInd)
+{
+   if ((psHdl->siPix+1)*2>psHdl->szPix) {
+      int   szPix=(psHdl->szPix)?psHdl->szPix:CLPINI_PIXCNT;
+      int*  piPix;
+      while (szPix<psHdl->siPtr*4) { szPix*=2; }
+      piPix=(int*)calloc(szPix,sizeof(int));
+      if (piPix==NULL) { return(-1); }
+      free(psHdl->piPix);
+      psHdl->piPix=piPix;
+      psHdl->szPix=szPix;
+      psHdl->siPix=0;
+      for (int i=0;i<psHdl->siPtr;i++) {
+         if (psHdl->psPtr[i].pvPtr!=NULL && i!=siInd) { vdClpPixIns(psHdl,i); }
+      }
+   }
+   vdClpPixIns(psHdl,siInd);
+   return(0);
+}
+
+static inline int siClpPixFnd(
+   TsHdl*                        psHdl,
+   const void*                   pvPtr)
+{
+   if (psHdl->szPix) {
+      U64 m=(U64)(psHdl->szPix-1);
+      U64 h=ClpPixHsh(pvPtr)&m;
+      while (psHdl->piPix[h]) {
+         if (psHdl->psPtr[psHdl->piPix[h]-1].pvPtr==pvPtr) { return(psHdl->piPix[h]-1); }
+         h=(h+1)&m;
+      }
+   }
+   return(-1);
+}
+
 static inline void* pvClpAllocNew(
    TsHdl*                        psHdl,
    const int                     siSiz,
@@ -1001,16 +1517,27 @@ static inline void* pvClpAllocNew(
 {
    if (siSiz>0) {
       if (psHdl->siPtr>=psHdl->szPtr) {
-         void* pvHlp=realloc_nowarn(psHdl->psPtr,sizeof(TsPtr)*(psHdl->szPtr+CLPINI_PTRCNT));
+         int   szPtr=(psHdl->szPtr)?psHdl->szPtr*2:CLPINI_PTRCNT;
+         void* pvHlp=realloc_nowarn(psHdl->psPtr,sizeof(TsPtr)*szPtr);
          if (pvHlp==NULL) { return(NULL); }
          psHdl->psPtr=pvHlp;
-         psHdl->szPtr+=CLPINI_PTRCNT;
+         psHdl->szPtr=szPtr;
       }
       void* pvPtr=calloc(1,siSiz);
       if (pvPtr==NULL) { return(NULL); }
       psHdl->psPtr[psHdl->siPtr].pvPtr=pvPtr;
       psHdl->psPtr[psHdl->siPtr].siSiz=siSiz;
+      psHdl->psPtr[psHdl->siPtr].siCap=siSiz;
       psHdl->psPtr[psHdl->siPtr].uiFlg=uiFlg;
+      psHdl->psPtr[psHdl->siPtr].isTmp=FALSE;
+      psHdl->psPtr[psHdl->siPtr].siPar=-1;
+      psHdl->psPtr[psHdl->siPtr].siOfs=0;
+      psHdl->psPtr[psHdl->siPtr].ppRef=NULL;
+      if (siClpPixAdd(psHdl,psHdl->siPtr)) {
+         free(pvPtr);
+         psHdl->psPtr[psHdl->siPtr].pvPtr=NULL;
+         return(NULL);
+      }
       if (piInd!=NULL) { *piInd=psHdl->siPtr; }
       psHdl->siPtr++;
       return(pvPtr);
@@ -1034,21 +1561,40 @@ static inline void* pvClpAllocAgain(
          psPtr->pvPtr =NULL;
       }
       psPtr->siSiz =0;
+      psPtr->siCap =0;
       psPtr->uiFlg|=uiFlg;
       return(NULL);
-   } else {
+   } else if (siSiz<=psPtr->siCap) { // the capacity behind the size is kept zero
       if (psPtr->siSiz>siSiz) { // smaller
          if (CLPISF_PWD(psPtr->uiFlg)) {
             secure_memset(((char*)psPtr->pvPtr)+siSiz,psPtr->siSiz-siSiz);
+         } else {
+            memset(((char*)psPtr->pvPtr)+siSiz,0,psPtr->siSiz-siSiz);
          }
       }
-      void* pvPtr=realloc_nowarn(psPtr->pvPtr,siSiz);
-      if (pvPtr==NULL) { return(NULL); }
-      if (psPtr->siSiz<siSiz) { // larger
-         memset(((char*)pvPtr)+psPtr->siSiz,0,siSiz-psPtr->siSiz);
+      psPtr->siSiz =siSiz;
+      psPtr->uiFlg|=uiFlg;
+      return(psPtr->pvPtr);
+   } else { // larger than capacity, grow geometrically
+      int   siCap=(psPtr->siCap<INT_MAX/2)?psPtr->siCap*2:INT_MAX;
+      void* pvPtr;
+      if (siCap<siSiz) { siCap=siSiz; }
+      if (CLPISF_PWD(psPtr->uiFlg|uiFlg)) { // don't leave a copy of a password behind if the memory moves
+         pvPtr=calloc(1,siCap);
+         if (pvPtr==NULL) { return(NULL); }
+         if (psPtr->siSiz) {
+            memcpy(pvPtr,psPtr->pvPtr,psPtr->siSiz);
+            secure_memset(psPtr->pvPtr,psPtr->siSiz);
+         }
+         free(psPtr->pvPtr);
+      } else {
+         pvPtr=realloc_nowarn(psPtr->pvPtr,siCap);
+         if (pvPtr==NULL) { return(NULL); }
+         memset(((char*)pvPtr)+psPtr->siSiz,0,siCap-psPtr->siSiz);
       }
       psPtr->pvPtr =pvPtr;
       psPtr->siSiz =siSiz;
+      psPtr->siCap =siCap;
       psPtr->uiFlg|=uiFlg;
       return(pvPtr);
    }
@@ -1065,21 +1611,57 @@ extern void* pvClpAllocFlg(
    if (pvPtr==NULL) {
       return(pvClpAllocNew(psHdl,siSiz,piInd,uiFlg));
    } else {
-      if (piInd!=NULL && *piInd>=0 && *piInd<psHdl->siPtr && psHdl->psPtr[*piInd].pvPtr==pvPtr) {
-         return(pvClpAllocAgain(psHdl->psPtr+(*piInd),siSiz,uiFlg));
+      int i=(piInd!=NULL && *piInd>=0 && *piInd<psHdl->siPtr && psHdl->psPtr[*piInd].pvPtr==pvPtr)?*piInd:siClpPixFnd(psHdl,pvPtr);
+      if (i>=0) {
+         void* pvNew=pvClpAllocAgain(psHdl->psPtr+i,siSiz,uiFlg);
+         if (pvNew!=NULL && pvNew!=pvPtr) {
+            if (siClpPixAdd(psHdl,i)) { return(NULL); }
+         }
+         if (piInd!=NULL) { *piInd=i; }
+         return(pvNew);
       } else {
-         for (int i=0;i<psHdl->siPtr;i++) {
-            if (psHdl->psPtr[i].pvPtr==pvPtr) {
-               pvPtr=pvClpAllocAgain(psHdl->psPtr+i,siSiz,uiFlg);
-               if (piInd!=NULL) { *piInd=i; }
-               return(pvPtr);
-            }
-         }
          return(pvClpAllocNew(psHdl,siSiz,piInd,uiFlg));
       }
    }
 }
 
+static void* pvClpAllocDat( // remembers where the pointer is stored, relative to the buffer of a dynamic parent if it is inside
+   TsHdl*                        psHdl,
+   const TsSym*                  psArg,
+   void**                        ppDat,
+   const int                     siSiz)
+{
+   void*                         pvDat=pvClpAllocFlg(psHdl,(*ppDat),siSiz,&GETVAR(psHdl,psArg)->siInd,psArg->psStd->uiFlg);
+   if (pvDat!=NULL) {
+      TsPtr*                     psPtr=psHdl->psPtr+GETVAR(psHdl,psArg)->siInd;
+      const TsSym*               psHih;
+      psPtr->siPar=-1;
+      psPtr->siOfs=0;
+      psPtr->ppRef=ppDat;
+      for (psHih=psArg->psHih;psHih!=NULL && !CLPISF_DYN(psHih->psStd->uiFlg);psHih=psHih->psHih);
+      if (psHih!=NULL) {
+         int siPar=GETVAR(psHdl,psHih)->siInd;
+         if (siPar>=0 && siPar<psHdl->siPtr && psHdl->psPtr[siPar].pvPtr!=NULL &&
+             (char*)ppDat>=(char*)psHdl->psPtr[siPar].pvPtr && (char*)ppDat<((char*)psHdl->psPtr[siPar].pvPtr)+psHdl->psPtr[siPar].siSiz) {
+            psPtr->siPar=siPar;
+            psPtr->siOfs=(int)((char*)ppDat-(char*)psHdl->psPtr[siPar].pvPtr);
+            psPtr->ppRef=NULL;
+         }
+      }
+   }
+   return(pvDat);
+}
+
+static inline void** ppClpPtrRef(
+   TsHdl*                        psHdl,
+   const TsPtr*                  psPtr)
+{
+   if (psPtr->siPar>=0) {
+      return((void**)(((char*)psHdl->psPtr[psPtr->siPar].pvPtr)+psPtr->siOfs));
+   }
+   return(psPtr->ppRef);
+}
+
 static void vdClpFree(
    TsHdl*                        psHdl)
 {
@@ -1180,6 +1762,143 @@ extern char* pcClpError(
    }
 }
 
+/* The buffers of a closed handle are kept in a pool per thread (UNIX only) and reused by the next open, so
+ * the buffers grown by large lexemes or lists survive vdClpClose() and are not allocated again. Buffers
+ * greater than CLPPOL_MAX are released. The pool is not used while a thread allocator is installed. The
+ * buffers are cleared before they are put into the pool and each entry records the allocator which filled
+ * it, an entry of another allocator than the current one is released instead of reused. At the end of the
+ * thread each entry is released with its allocator and the pool with the allocator recorded at its creation.*/
+static void vdClpPolFre(
+   const TsCleAlc*               psAlc,
+   void*                         pvPtr)
+{
+   if (pvPtr!=NULL) {
+      if (psAlc->pfFree!=NULL) {
+         psAlc->pfFree(psAlc->pvAlc,pvPtr);
+      } else {
+         (free)(pvPtr);
+      }
+   }
+}
+
+#ifdef __UNIX__
+
+static void vdClpPolDel(
+   void*                         pvPol)
+{
+   TsPol*                        psPol=(TsPol*)pvPol;
+   TsCleAlc                      stAlc=psPol->stAlc;
+   int                           i,j;
+   for (i=0;i<psPol->siCnt;i++) {
+      for (j=0;j<CLPPOL_BUF;j++) {
+         vdClpPolFre(&psPol->asAlc[i],psPol->apBuf[i][j]);
+      }
+   }
+   vdClpPolFre(&stAlc,psPol);
+}
+
+static void vdClpPolKey(void)
+{
+   isClpPolKey=(pthread_key_create(&stClpPolKey,vdClpPolDel)==0);
+}
+#endif
+
+static TsPol* psClpPol(
+   const int                     isNew)
+{
+#ifdef __UNIX__
+   TsPol*                        psPol;
+   if (cle_thdalc()) return(NULL);
+   pthread_once(&stClpPolOnc,vdClpPolKey);
+   if (!isClpPolKey) return(NULL);
+   psPol=(TsPol*)pthread_getspecific(stClpPolKey);
+   if (psPol==NULL && isNew) {
+      psPol=(TsPol*)calloc(1,sizeof(TsPol));
+      if (psPol!=NULL) {
+         cle_getalc(&psPol->stAlc);
+         if (pthread_setspecific(stClpPolKey,psPol)) {
+            free(psPol);
+            psPol=NULL;
+         }
+      }
+   }
+   return(psPol);
+#else
+   (void)isNew;
+   return(NULL);
+#endif
+}
+
+static int siClpPolGet(
+   TsHdl*                        psHdl)
+{
+   char**                        appBuf[CLPPOL_BUF]={&psHdl->pcLex,&psHdl->pcSrc,&psHdl->pcPre,&psHdl->pcPat,&psHdl->pcLst,&psHdl->pcMsg};
+   size_t*                       apzBuf[CLPPOL_BUF]={&psHdl->szLex,&psHdl->szSrc,&psHdl->szPre,&psHdl->szPat,&psHdl->szLst,&psHdl->szMsg};
+   const size_t                  azIni[CLPPOL_BUF]={CLPINI_LEXSIZ,CLPINI_SRCSIZ,CLPINI_PRESIZ,CLPINI_PATSIZ,CLPINI_LSTSIZ,CLPINI_MSGSIZ};
+   TsPol*                        psPol=psClpPol(FALSE);
+   TsCleAlc                      stAlc;
+   int                           isErr=FALSE;
+   int                           i;
+   if (psPol!=NULL) {
+      cle_getalc(&stAlc);
+      while (psPol->siCnt>0) {
+         psPol->siCnt--;
+         if (memcmp(&psPol->asAlc[psPol->siCnt],&stAlc,sizeof(stAlc))==0) {
+            for (i=0;i<CLPPOL_BUF;i++) {
+               (*appBuf[i])=psPol->apBuf[psPol->siCnt][i];
+               (*apzBuf[i])=psPol->azBuf[psPol->siCnt][i];
+            }
+            break;
+         }
+         for (i=0;i<CLPPOL_BUF;i++) {
+            vdClpPolFre(&psPol->asAlc[psPol->siCnt],psPol->apBuf[psPol->siCnt][i]);
+         }
+      }
+   }
+   for (i=0;i<CLPPOL_BUF;i++) {
+      if ((*appBuf[i])==NULL) {
+         (*apzBuf[i])=azIni[i];
+         (*appBuf[i])=(char*)calloc(1,azIni[i]);
+         if ((*appBuf[i])==NULL) isErr=TRUE;
+      }
+   }
+   psHdl->siLst=0;
+   return((isErr)?-1:0);
+}
+
+static void vdClpPolPut(
+   TsHdl*                        psHdl)
+{
+   char**                        appBuf[CLPPOL_BUF]={&psHdl->pcLex,&psHdl->pcSrc,&psHdl->pcPre,&psHdl->pcPat,&psHdl->pcLst,&psHdl->pcMsg};
+   size_t*                       apzBuf[CLPPOL_BUF]={&psHdl->szLex,&psHdl->szSrc,&psHdl->szPre,&psHdl->szPat,&psHdl->szLst,&psHdl->szMsg};
+   TsPol*                        psPol=psClpPol(TRUE);
+   int                           i;
+   if (psPol!=NULL && psPol->siCnt<CLPPOL_CNT) {
+      cle_getalc(&psPol->asAlc[psPol->siCnt]);
+      for (i=0;i<CLPPOL_BUF;i++) {
+         if ((*appBuf[i])!=NULL && (*apzBuf[i])<=CLPPOL_MAX) {
+            memset(*appBuf[i],0,*apzBuf[i]);
+            psPol->apBuf[psPol->siCnt][i]=(*appBuf[i]);
+            psPol->azBuf[psPol->siCnt][i]=(*apzBuf[i]);
+         } else {
+            SAFE_FREE(*appBuf[i]);
+            psPol->apBuf[psPol->siCnt][i]=NULL;
+            psPol->azBuf[psPol->siCnt][i]=0;
+         }
+      }
+      psPol->siCnt++;
+   } else {
+      for (i=0;i<CLPPOL_BUF;i++) {
+         SAFE_FREE(*appBuf[i]);
+      }
+   }
+   for (i=0;i<CLPPOL_BUF;i++) {
+      (*appBuf[i])=NULL;
+      (*apzBuf[i])=0;
+   }
+   psHdl->siLst=0;
+}
+
 static int siOwnFile2String(void* gbl, const void* hdl, const char* filename, char** buf, int* bufsize, char* errmsg, const int msgsiz) {
    (void)gbl;
    char* pcFil=dcpmapfil(filename);
@@ -1195,12 +1914,25 @@ static int siExtentSymTab(
    const TsSym*                  psArg)
 {
    psHdl->apPat[siLev]=psArg;
-   if (psArg->psDep==NULL && psArg->psTab!=NULL) {
+   if (psArg->psDep==NULL && psArg->psTab!=NULL && !psHdl->psTpl->isShr) {
       int siErr;
       siErr=siClpSymIni(psHdl,siLev+1,psArg->psArg,psArg->psTab,(TsSym*)psArg,NULL);
       if (siErr<0) { return(siErr); }
       siErr=siClpSymCal(psHdl,siLev+1,psArg,psArg->psDep);
       if (siErr<0) { return(siErr); }
+      siErr=siClpVarExt(psHdl);
+      if (siErr<0) { return(siErr); }
+   }
+   return(CLP_OK);
+}
+
+static inline int siExtentConTab(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   const TsSym*                  psArg)
+{
+   if (psArg->psDep==NULL && psArg->psTab!=NULL && psArg->psFix->siTyp!=CLPTYP_OBJECT && psArg->psFix->siTyp!=CLPTYP_OVRLAY) {
+      return(siExtentSymTab(psHdl,siLev,psArg));
    }
    return(CLP_OK);
 }
@@ -1238,7 +1970,11 @@ extern void* pvClpOpen(
    TsHdl*                        psHdl=NULL;
    const char*                   pcNow=NULL;
    I64                           siNow=0;
-   int                           siErr,i;
+   char*                         pcImg=NULL;
+   TsImc                         stImc;
+   int                           isImg=FALSE;
+   int                           isTpl=FALSE;
+   int                           siErr;
    if (psTab!=NULL) {
       flsrand(flseed);
       psHdl=(TsHdl*)calloc(1,sizeof(TsHdl));
@@ -1261,19 +1997,7 @@ extern void* pvClpOpen(
          psHdl->pcCur=NULL;
          psHdl->pcOld=NULL;
          psHdl->psPtr=NULL;
-         psHdl->szLex=CLPINI_LEXSIZ;
-         psHdl->pcLex=(C08*)calloc(1,psHdl->szLex);
-         psHdl->szSrc=CLPINI_SRCSIZ;
-         psHdl->pcSrc=(C08*)calloc(1,psHdl->szSrc);
-         psHdl->szPre=CLPINI_PRESIZ;
-         psHdl->pcPre=(C08*)calloc(1,psHdl->szPre);
-         psHdl->szPat=CLPINI_PATSIZ;
-         psHdl->pcPat=(C08*)calloc(1,psHdl->szPat);
-         psHdl->szLst=CLPINI_LSTSIZ;
-         psHdl->pcLst=(C08*)calloc(1,psHdl->szLst);
-         psHdl->szMsg=CLPINI_MSGSIZ;
-         psHdl->pcMsg=(C08*)calloc(1,psHdl->szMsg);
-         if (psHdl->pcLex==NULL || psHdl->pcSrc==NULL || psHdl->pcPre==NULL || psHdl->pcPat==NULL || psHdl->pcLst==NULL || psHdl->pcMsg==NULL)  {
+         if (siClpPolGet(psHdl))  {
             SAFE_FREE(psHdl->pcLex);
             SAFE_FREE(psHdl->pcSrc);
             SAFE_FREE(psHdl->pcPre);
@@ -1283,10 +2007,12 @@ extern void* pvClpOpen(
             free(psHdl);
             return(NULL);
          }
-         for (i=0;i<CLPMAX_BUFCNT;i++) {
-            psHdl->pzBuf[i]=0;
-            psHdl->apBuf[i]=NULL;
-         }
+         psHdl->siBuf=0;
+         psHdl->szBuf=0;
+         psHdl->pzBuf=NULL;
+         psHdl->apBuf=NULL;
+         psHdl->szInp=0;
+         psHdl->psStm=NULL;
          psHdl->pvDat=pvDat;
          psHdl->psTab=NULL;
          psHdl->psSym=NULL;
@@ -1312,18 +2038,8 @@ extern void* pvClpOpen(
          psHdl->pvSaf=pvSaf;
          psHdl->pfSaf=pfSaf;
 
-#if defined(__DEBUG__) && defined(__HEAP_STATISTIC__)
-         long siBeginCurHeapSize=CUR_HEAP_SIZE();
-#endif
-         siErr=siClpSymIni(psHdl,0,NULL,psTab,NULL,&psHdl->psTab);
-         if (siErr<0) {
-            uint64_t uiCnt=0;
-            uint64_t uiSiz=0;
-            vdClpSymDel(psHdl->psTab,&uiCnt,&uiSiz);
-            if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
-               char acTs[24];
-               fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Amount(%"PRIu64"),Size(%"PRIu64")) after fail of in siClpSymIni()\n",cstime(0,acTs),uiCnt,uiSiz);
-            }
+         isTpl=siClpTplGet(psHdl,psTab);
+         if (isTpl<0) {
             SAFE_FREE(psHdl->pcLex);
             SAFE_FREE(psHdl->pcSrc);
             SAFE_FREE(psHdl->pcPre);
@@ -1333,37 +2049,77 @@ extern void* pvClpOpen(
             free(psHdl);
             return(NULL);
          }
+         if (!isTpl) {
+            pcImg=pcClpImgFil(psHdl,psTab,&stImc);
+         }
+         if (pcImg!=NULL) {
+            isImg=siClpImgLod(psHdl,&stImc,pcImg);
+            if (isImg<0) {
+               vdClpTplRel(psHdl,"after fail of in siClpImgLod()");
+               vdClpImgDel(&stImc);
+               free(pcImg);
+               SAFE_FREE(psHdl->pcLex);
+               SAFE_FREE(psHdl->pcSrc);
+               SAFE_FREE(psHdl->pcPre);
+               SAFE_FREE(psHdl->pcPat);
+               SAFE_FREE(psHdl->pcLst);
+               SAFE_FREE(psHdl->pcMsg);
+               free(psHdl);
+               return(NULL);
+            }
+         }
+         if (!isTpl && !isImg) {
 #if defined(__DEBUG__) && defined(__HEAP_STATISTIC__)
-         long siEndCurHeapSize=CUR_HEAP_SIZE();
-         printd("---------- CLP-SYMTAB-CUR_HEAP_SIZE(%ld)=>%ld(%ld) Count==%ld(%ld)\n",siBeginCurHeapSize,siEndCurHeapSize,siEndCurHeapSize-siBeginCurHeapSize,psHdl->siSym,(siEndCurHeapSize-siBeginCurHeapSize)/psHdl->siSym);
+            long siBeginCurHeapSize=CUR_HEAP_SIZE();
 #endif
-         siErr=siClpSymCal(psHdl,0,NULL,psHdl->psTab);
-         if (siErr<0) {
-            uint64_t uiCnt=0;
-            uint64_t uiSiz=0;
-            vdClpSymDel(psHdl->psTab,&uiCnt,&uiSiz);
-            if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
-               char acTs[24];
-               fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Amount(%"PRIu64"),Size(%"PRIu64")) after fail of in siClpSymCal()\n",cstime(0,acTs),uiCnt,uiSiz);
+            siErr=siClpSymIni(psHdl,0,NULL,psTab,NULL,&psHdl->psTab);
+            psHdl->psTpl->psTab=psHdl->psTab;
+            if (siErr<0) {
+               vdClpTplRel(psHdl,"after fail of in siClpSymIni()");
+               vdClpImgDel(&stImc);
+               SAFE_FREE(pcImg);
+               SAFE_FREE(psHdl->pcLex);
+               SAFE_FREE(psHdl->pcSrc);
+               SAFE_FREE(psHdl->pcPre);
+               SAFE_FREE(psHdl->pcPat);
+               SAFE_FREE(psHdl->pcLst);
+               SAFE_FREE(psHdl->pcMsg);
+               free(psHdl);
+               return(NULL);
             }
-            SAFE_FREE(psHdl->pcLex);
-            SAFE_FREE(psHdl->pcSrc);
-            SAFE_FREE(psHdl->pcPre);
-            SAFE_FREE(psHdl->pcPat);
-            SAFE_FREE(psHdl->pcLst);
-            SAFE_FREE(psHdl->pcMsg);
-            free(psHdl);
-            return(NULL);
+#if defined(__DEBUG__) && defined(__HEAP_STATISTIC__)
+            long siEndCurHeapSize=CUR_HEAP_SIZE();
+            printd("---------- CLP-SYMTAB-CUR_HEAP_SIZE(%ld)=>%ld(%ld) Count==%ld(%ld)\n",siBeginCurHeapSize,siEndCurHeapSize,siEndCurHeapSize-siBeginCurHeapSize,psHdl->psTpl->siSym,(siEndCurHeapSize-siBeginCurHeapSize)/psHdl->psTpl->siSym);
+#endif
+            siErr=siClpSymCal(psHdl,0,NULL,psHdl->psTab);
+            if (siErr<0) {
+               vdClpTplRel(psHdl,"after fail of in siClpSymCal()");
+               vdClpImgDel(&stImc);
+               SAFE_FREE(pcImg);
+               SAFE_FREE(psHdl->pcLex);
+               SAFE_FREE(psHdl->pcSrc);
+               SAFE_FREE(psHdl->pcPre);
+               SAFE_FREE(psHdl->pcPat);
+               SAFE_FREE(psHdl->pcLst);
+               SAFE_FREE(psHdl->pcMsg);
+               free(psHdl);
+               return(NULL);
+            }
+            if (pcImg!=NULL) {
+               vdClpImgSav(psHdl,&stImc,pcImg);
+            }
+         }
+         if (!isTpl) {
+            vdClpImgDel(&stImc);
+            SAFE_FREE(pcImg);
+            vdClpTplReg(psHdl);
+         }
+         siErr=siClpVarExt(psHdl);
+         if (siErr>=0) {
+            siErr=siClpSymTrc(psHdl);
          }
-         siErr=siClpSymTrc(psHdl);
          if (siErr<0) {
-            uint64_t uiCnt=0;
-            uint64_t uiSiz=0;
-            vdClpSymDel(psHdl->psTab,&uiCnt,&uiSiz);
-            if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
-               char acTs[24];
-               fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Amount(%"PRIu64"),Size(%"PRIu64")) after fail of in siClpSymCal()\n",cstime(0,acTs),uiCnt,uiSiz);
-            }
+            vdClpTplRel(psHdl,"after fail of in siClpSymTrc()");
             SAFE_FREE(psHdl->pcLex);
             SAFE_FREE(psHdl->pcSrc);
             SAFE_FREE(psHdl->pcPre);
@@ -1449,6 +2205,7 @@ extern int siClpParsePro(
 
    if (psHdl->pcLst!=NULL) {
       psHdl->pcLst[0]=0x00;
+      psHdl->siLst=0;
    }
 
    if (pcSrc!=NULL && *pcSrc) {
@@ -1456,7 +2213,10 @@ extern int siClpParsePro(
    } else {
       srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(CLPSRC_PRO),"%s",CLPSRC_PRO);
    }
-   psHdl->pcInp=pcClpUnEscape(psHdl,pcPro);
+   vdClpStmFre(psHdl,TRUE);
+   psHdl->siBuf=0;
+   psHdl->szInp=0;
+   psHdl->pcInp=pcClpUnEscape(psHdl,pcPro,FALSE);
    if (psHdl->pcInp==NULL) {
       return CLPERR(psHdl,CLPERR_MEM,"Un-escaping of property string failed");
    }
@@ -1473,9 +2233,9 @@ extern int siClpParsePro(
 #endif
       TRACE(psHdl->pfPrs,"PROPERTY-PARSER-BEGIN\n");
       psHdl->siTok=siClpScnSrc(psHdl,0,NULL);
-      if (psHdl->siTok<0) { return(psHdl->siTok); }
+      if (psHdl->siTok<0) { return(siClpInpRel(psHdl,psHdl->siTok)); }
       siCnt=siClpPrsProLst(psHdl,psHdl->psTab);
-      if (siCnt<0) { return(siCnt); }
+      if (siCnt<0) { return(siClpInpRel(psHdl,siCnt)); }
 #if defined(__DEBUG__) && defined(__HEAP_STATISTIC__)
       long siEndCurHeapSize=CUR_HEAP_SIZE();
       printd("---------- CLP-PRSPRO-CUR_HEAP_SIZE(%ld)=>%ld(%ld)\n",siBeginCurHeapSize,siEndCurHeapSize,siEndCurHeapSize-siBeginCurHeapSize);
@@ -1492,33 +2252,214 @@ extern int siClpParsePro(
          return(siCnt);
       } else {
          if (ppLst!=NULL) { *ppLst=psHdl->pcLst; }
-         return CLPERR(psHdl,CLPERR_SYN,"Last token (%s(%s)) of property list is not EOS",pcMapClpTok(psHdl->siTok),psHdl->pcLex);
+         return(siClpInpRel(psHdl,CLPERR(psHdl,CLPERR_SYN,"Last token (%s(%s)) of property list is not EOS",pcMapClpTok(psHdl->siTok),psHdl->pcLex)));
       }
    } else {
       if (ppLst!=NULL) { *ppLst=psHdl->pcLst; }
-      return CLPERR(psHdl,CLPERR_SYN,"Initial token (%s(%s)) in handle is not valid",pcMapClpTok(psHdl->siTok),psHdl->pcLex);
+      return(siClpInpRel(psHdl,CLPERR(psHdl,CLPERR_SYN,"Initial token (%s(%s)) in handle is not valid",pcMapClpTok(psHdl->siTok),psHdl->pcLex)));
    }
 }
 
-static int siClpParseCmd2(
+static int siClpSnpAdd(
    TsHdl*                        psHdl,
-   const char*                   pcSrc,
-   const char*                   pcCmd,
-   const int                     isChk,
-   const int                     isPwd,
-   const int                     isOvl,
-   int*                          piOid,
-   char**                        ppLst)
+   TsSnp*                        psSnp,
+   const char*                   pcPat,
+   const TsPro*                  psPro)
 {
-   int                           siCnt;
-
-   if (pcCmd==NULL) {
-      return CLPERR(psHdl,CLPERR_INT,"Command string is NULL");
-   }
+   TsSne*                        psEnt;
+   if (psSnp->siCnt>=psSnp->szEnt) {
+      int    szEnt=(psSnp->szEnt)?psSnp->szEnt*2:16;
+      void*  pvHlp=realloc_nowarn(psSnp->psEnt,sizeof(TsSne)*szEnt);
+      if (pvHlp==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for property snapshot (%d entries) failed",szEnt);
+      }
+      psSnp->psEnt=(TsSne*)pvHlp;
+      psSnp->szEnt=szEnt;
+   }
+   psEnt=psSnp->psEnt+psSnp->siCnt;
+   psEnt->pcPat=malloc(strlen(pcPat)+1);
+   psEnt->pcPro=malloc(strlen(psPro->pcPro)+1);
+   psEnt->pcSrc=malloc(strlen((psPro->pcSrc!=NULL)?psPro->pcSrc:CLPSRC_PRO)+1);
+   if (psEnt->pcPat==NULL || psEnt->pcPro==NULL || psEnt->pcSrc==NULL) {
+      SAFE_FREE(psEnt->pcPat); SAFE_FREE(psEnt->pcPro); SAFE_FREE(psEnt->pcSrc);
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for property snapshot of '%s' failed",pcPat);
+   }
+   strcpy(psEnt->pcPat,pcPat);
+   strcpy(psEnt->pcPro,psPro->pcPro);
+   strcpy(psEnt->pcSrc,(psPro->pcSrc!=NULL)?psPro->pcSrc:CLPSRC_PRO);
+   psEnt->siRow=psPro->siRow;
+   psSnp->siCnt++;
+   return(CLP_OK);
+}
 
-   if (psHdl->pcLst!=NULL) {
-      psHdl->pcLst[0]=0x00;
-   }
+static int siClpSnpSym(
+   TsHdl*                        psHdl,
+   TsSnp*                        psSnp,
+   const TsSym*                  psTab,
+   const int                     siLev,
+   char*                         pcPat,
+   const size_t                  l)
+{
+   const TsSym*                  psSym;
+   int                           siErr;
+
+   for (psSym=psTab;psSym!=NULL;psSym=psSym->psNxt) {
+      if (psSym->psStd->psAli==NULL && psSym->siVar>=0) {
+         pcPat[l]='.';
+         strcpy(pcPat+l+1,psSym->psStd->pcKyw);
+         if (OWNPRO(psHdl,psSym)!=NULL) {
+            siErr=siClpSnpAdd(psHdl,psSnp,pcPat,GETPRO(psHdl,psSym));
+            if (siErr<0) return(siErr);
+         }
+         if (psSym->psDep!=NULL && siLev+1<CLPMAX_HDEPTH) {
+            siErr=siClpSnpSym(psHdl,psSnp,psSym->psDep,siLev+1,pcPat,l+1+strlen(psSym->psStd->pcKyw));
+            if (siErr<0) return(siErr);
+         }
+      }
+   }
+   pcPat[l]=EOS;
+   return(CLP_OK);
+}
+
+extern void* pvClpSnapPro(
+   void*                         pvHdl)
+{
+   TsHdl*                        psHdl=(TsHdl*)pvHdl;
+   TsSnp*                        psSnp;
+   int                           siErr;
+
+   if (psHdl==NULL) return(NULL);
+   char                          acPat[strlen(psHdl->pcOwn)+strlen(psHdl->pcPgm)+strlen(psHdl->pcCmd)+3+CLPMAX_HDEPTH*CLPMAX_KYWSIZ];
+   size_t                        l=snprintf(acPat,sizeof(acPat),"%s.%s.%s",psHdl->pcOwn,psHdl->pcPgm,psHdl->pcCmd);
+
+   psSnp=(TsSnp*)calloc(1,sizeof(TsSnp));
+   if (psSnp==NULL) {
+      CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for property snapshot failed");
+      return(NULL);
+   }
+   siErr=siClpSnpSym(psHdl,psSnp,psHdl->psTab,0,acPat,l);
+   if (siErr<0) {
+      vdClpFreePro(psSnp);
+      return(NULL);
+   }
+   TRACE(psHdl->pfPrs,"PROPERTY-SNAPSHOT(CNT=%d)\n",psSnp->siCnt);
+   return(psSnp);
+}
+
+static void vdClpProRst(
+   TsHdl*                        psHdl)
+{
+   int                           i;
+   for (i=0;i<psHdl->siVar;i++) {
+      if (psHdl->psPro[i].pcPro!=psHdl->psTpl->psPro[i].pcPro) SAFE_FREE(psHdl->psPro[i].pcPro);
+      if (psHdl->psPro[i].pcSrc!=psHdl->psTpl->psPro[i].pcSrc) SAFE_FREE(psHdl->psPro[i].pcSrc);
+      psHdl->psPro[i].pcDft=psHdl->psTpl->psPro[i].pcDft;
+      psHdl->psPro[i].pcPro=psHdl->psTpl->psPro[i].pcPro;
+      psHdl->psPro[i].pcSrc=psHdl->psTpl->psPro[i].pcSrc;
+      psHdl->psPro[i].siRow=psHdl->psTpl->psPro[i].siRow;
+      psHdl->psDfc[i].pcDft=NULL;
+      psHdl->psDfc[i].isDyn=FALSE;
+      psHdl->psDfc[i].siVal=0;
+      psHdl->psDfc[i].siBuf=0;
+   }
+}
+
+static int siClpSnpApp(
+   TsHdl*                        psHdl,
+   const TsSnp*                  psSnp,
+   const int                     isChk)
+{
+   int                           i,siErr;
+   psHdl->isChk=isChk;
+   for (i=0;i<psSnp->siCnt;i++) {
+      srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(psSnp->psEnt[i].pcSrc),"%s",psSnp->psEnt[i].pcSrc);
+      psHdl->siRow=psSnp->psEnt[i].siRow;
+      psHdl->siCol=0;
+      siErr=siClpBldPro(psHdl,psSnp->psEnt[i].pcPat,psSnp->psEnt[i].pcPro,psSnp->psEnt[i].siRow);
+      if (siErr<0) {
+         psHdl->isChk=FALSE;
+         psHdl->siRow=1;
+         return(siErr);
+      }
+   }
+   psHdl->isChk=FALSE;
+   psHdl->siRow=1;
+   return(psSnp->siCnt);
+}
+
+extern int siClpApplyPro(
+   void*                         pvHdl,
+   const void*                   pvSnp,
+   const int                     isChk)
+{
+   TsHdl*                        psHdl=(TsHdl*)pvHdl;
+   const TsSnp*                  psSnp=(const TsSnp*)pvSnp;
+   TsSnp*                        psOld=NULL;
+   int                           i,siCnt;
+
+   if (psSnp==NULL) {
+      return CLPERR(psHdl,CLPERR_INT,"Property snapshot is NULL");
+   }
+   for (i=0;i<psHdl->siVar && psHdl->psPro[i].pcPro==psHdl->psTpl->psPro[i].pcPro;i++);
+   if (i<psHdl->siVar) { // properties already set are captured to roll back a failed apply
+      psOld=(TsSnp*)pvClpSnapPro(psHdl);
+      if (psOld==NULL) return(CLPERR_MEM);
+   }
+   if (psHdl->pcLst!=NULL) {
+      psHdl->pcLst[0]=0x00;
+      psHdl->siLst=0;
+   }
+   TRACE(psHdl->pfPrs,"PROPERTY-SNAPSHOT-APPLY-BEGIN\n");
+   siCnt=siClpSnpApp(psHdl,psSnp,isChk);
+   if (siCnt<0) {
+      vdClpProRst(psHdl);
+      if (psOld!=NULL) siClpSnpApp(psHdl,psOld,FALSE);
+      vdClpFreePro(psOld);
+      TRACE(psHdl->pfPrs,"PROPERTY-SNAPSHOT-APPLY-FAILED(%d)\n",siCnt);
+      return(siCnt);
+   }
+   vdClpFreePro(psOld);
+   TRACE(psHdl->pfPrs,"PROPERTY-SNAPSHOT-APPLY-END(CNT=%d)\n",siCnt);
+   return(siCnt);
+}
+
+extern void vdClpFreePro(
+   void*                         pvSnp)
+{
+   TsSnp*                        psSnp=(TsSnp*)pvSnp;
+   int                           i;
+
+   if (psSnp!=NULL) {
+      for (i=0;i<psSnp->siCnt;i++) {
+         SAFE_FREE(psSnp->psEnt[i].pcPat);
+         SAFE_FREE(psSnp->psEnt[i].pcPro);
+         SAFE_FREE(psSnp->psEnt[i].pcSrc);
+      }
+      SAFE_FREE(psSnp->psEnt);
+      free(psSnp);
+   }
+}
+
+static int siClpParseCmd2(
+   TsHdl*                        psHdl,
+   const char*                   pcSrc,
+   const char*                   pcCmd,
+   const int                     isChk,
+   const int                     isPwd,
+   const int                     isOvl,
+   int*                          piOid,
+   char**                        ppLst)
+{
+   int                           siCnt;
+
+   if (pcCmd==NULL) {
+      return CLPERR(psHdl,CLPERR_INT,"Command string is NULL");
+   }
+
+   if (psHdl->pcLst!=NULL) {
+      psHdl->pcLst[0]=0x00;
+      psHdl->siLst=0;
+   }
 
    if (pcSrc!=NULL && *pcSrc) {
       if (*pcSrc!=':') { // file
@@ -1529,7 +2470,10 @@ static int siClpParseCmd2(
    } else {
       srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(CLPSRC_CMD),"%s",CLPSRC_CMD);
    }
-   psHdl->pcInp=pcClpUnEscape(psHdl,pcCmd);
+   vdClpStmFre(psHdl,TRUE);
+   psHdl->siBuf=0;
+   psHdl->szInp=0;
+   psHdl->pcInp=pcClpUnEscape(psHdl,pcCmd,FALSE);
    if (psHdl->pcInp==NULL) {
       return CLPERR(psHdl,CLPERR_MEM,"Un-escaping of command string failed");
    }
@@ -1547,9 +2491,10 @@ static int siClpParseCmd2(
 #endif
       TRACE(psHdl->pfPrs,"COMMAND-PARSER-BEGIN\n");
       psHdl->siTok=siClpScnSrc(psHdl,0,NULL);
-      if (psHdl->siTok<0) { return(psHdl->siTok); }
+      if (psHdl->siTok<0) { return(siClpInpRel(psHdl,psHdl->siTok)); }
+      psHdl->siSav=0;
       siCnt=siClpPrsMain(psHdl,psHdl->psTab,isOvl,piOid);
-      if (siCnt<0) { return (siCnt); }
+      if (siCnt<0) { return(siClpInpRel(psHdl,siCnt)); }
 #if defined(__DEBUG__) && defined(__HEAP_STATISTIC__)
       long siEndCurHeapSize=CUR_HEAP_SIZE();
       printd("---------- CLP-PRSCMD-CUR_HEAP_SIZE(%ld)=>%ld(%ld)\n",siBeginCurHeapSize,siEndCurHeapSize,siEndCurHeapSize-siBeginCurHeapSize);
@@ -1566,11 +2511,11 @@ static int siClpParseCmd2(
          return(siCnt);
       } else {
          if (ppLst!=NULL) { *ppLst=psHdl->pcLst; }
-         return CLPERR(psHdl,CLPERR_SYN,"Last token (%s(%s)) of parameter list is not EOS",pcMapClpTok(psHdl->siTok),psHdl->pcLex);
+         return(siClpInpRel(psHdl,CLPERR(psHdl,CLPERR_SYN,"Last token (%s(%s)) of parameter list is not EOS",pcMapClpTok(psHdl->siTok),psHdl->pcLex)));
       }
    } else {
       if (ppLst!=NULL) { *ppLst=psHdl->pcLst; }
-      return CLPERR(psHdl,CLPERR_SYN,"Initial token (%s(%s)) in handle is not valid",pcMapClpTok(psHdl->siTok),psHdl->pcLex);
+      return(siClpInpRel(psHdl,CLPERR(psHdl,CLPERR_SYN,"Initial token (%s(%s)) in handle is not valid",pcMapClpTok(psHdl->siTok),psHdl->pcLex)));
    }
 }
 
@@ -1617,7 +2562,7 @@ extern int siClpSyntax(
    int                           siErr;
    unsigned int                  l=strlen(psHdl->pcCmd);
 
-   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; }
+   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; psHdl->siLst=0; }
 
    psHdl->pcInp=NULL;
    psHdl->pcCur=NULL;
@@ -1677,7 +2622,7 @@ extern const char* pcClpInfo(
    const char*                   pcKyw=NULL;
    unsigned int                  l=strlen(psHdl->pcCmd);
 
-   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; }
+   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; psHdl->siLst=0; }
 
    psHdl->pcInp=NULL;
    psHdl->pcCur=NULL;
@@ -1727,7 +2672,7 @@ extern int siClpHelp(
    const char*                   pcKyw=NULL;
    unsigned int                  l=strlen(psHdl->pcCmd);
 
-   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; }
+   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; psHdl->siLst=0; }
 
    psHdl->pcInp=NULL;
    psHdl->pcCur=NULL;
@@ -1962,7 +2907,7 @@ extern int siClpDocu(
 {
    TsHdl*                        psHdl=(TsHdl*)pvHdl;
 
-   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; }
+   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; psHdl->siLst=0; }
 
    psHdl->pcInp=NULL;
    psHdl->pcCur=NULL;
@@ -2388,7 +3333,7 @@ extern int siClpPrint(
 {
    TsHdl*                        psHdl=(TsHdl*)pvHdl;
 
-   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; }
+   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; psHdl->siLst=0; }
 
    psHdl->pcInp=NULL;
    psHdl->pcCur=NULL;
@@ -2499,7 +3444,7 @@ extern int siClpProperties(
    unsigned int                  l=strlen(psHdl->pcCmd);
    const char*                   pcArg=NULL;
 
-   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; }
+   if (psHdl->pcLst!=NULL) { psHdl->pcLst[0]=0x00; psHdl->siLst=0; }
 
    psHdl->pcInp=NULL;
    psHdl->pcCur=NULL;
@@ -2603,8 +3548,8 @@ extern int siClpSymbolTableWalk(
       psSym->siKwl=psHdl->psSym->psStd->siKwl;
       psSym->pcKyw=psHdl->psSym->psStd->pcKyw;
       psSym->pcAli=GETALI(psHdl->psSym);
-      psSym->uiFlg=psHdl->psSym->psStd->uiFlg;
-      psSym->pcDft=psHdl->psSym->psFix->pcDft;
+      psSym->uiFlg=psHdl->psSym->psStd->uiFlg|GETPRO(psHdl,psHdl->psSym)->uiFlg;
+      psSym->pcDft=GETPRO(psHdl,psHdl->psSym)->pcDft;
       psSym->pcMan=psHdl->psSym->psFix->pcMan;
       psSym->pcHlp=psHdl->psSym->psFix->pcHlp;
       psSym->siTyp=psHdl->psSym->psFix->siTyp;
@@ -2644,14 +3589,92 @@ extern int siClpSymbolTableUpdate(
       if (!CLPISF_ARG(psHdl->psSym->psStd->uiFlg)) {
          return CLPERR(psHdl,CLPERR_SIZ,"Update of property field failed (symbol (%s) is not a argument)",psHdl->psSym->psStd->pcKyw);
       }
-      pcHlp=realloc_nowarn(psHdl->psSym->psFix->pcPro,strlen(psSym->pcPro)+1);
+      pcHlp=realloc_nowarn(OWNPRO(psHdl,psHdl->psSym),strlen(psSym->pcPro)+1);
       if (pcHlp==NULL) {
          return CLPERR(psHdl,CLPERR_SIZ,"Update of property field failed (string (%d(%s)) too long)",(int)strlen(psSym->pcPro),psSym->pcPro);
       }
-      psHdl->psSym->psFix->pcPro=pcHlp;
-      strcpy(psHdl->psSym->psFix->pcPro,psSym->pcPro);
-      psHdl->psSym->psFix->pcDft=psHdl->psSym->psFix->pcPro;
-      psHdl->psSym->psStd->uiFlg|=CLPFLG_PDF;
+      GETPRO(psHdl,psHdl->psSym)->pcPro=pcHlp;
+      strcpy(GETPRO(psHdl,psHdl->psSym)->pcPro,psSym->pcPro);
+      GETPRO(psHdl,psHdl->psSym)->pcDft=GETPRO(psHdl,psHdl->psSym)->pcPro;
+      GETPRO(psHdl,psHdl->psSym)->uiFlg|=CLPFLG_PDF;
+      vdClpDfcRst(psHdl,psHdl->psSym);
+   }
+   return(CLP_OK);
+}
+
+extern int siClpConstant(
+   void*                         pvHdl,
+   const char*                   pcKyw,
+   const int                     siTyp,
+   const I64                     siNum,
+   const F64                     flNum,
+   const char*                   pcStr)
+{
+   TsHdl*                        psHdl=(TsHdl*)pvHdl;
+   TsCon*                        psCon;
+   char*                         pcHlp;
+   int                           siIdx;
+   int                           i;
+
+   if (pcKyw==NULL || !isalpha(*pcKyw)) {
+      return CLPERR(psHdl,CLPERR_PAR,"Keyword for constant (%s) must start with a letter",(pcKyw!=NULL)?pcKyw:"NULL");
+   }
+   for (i=1;pcKyw[i];i++) {
+      if (!isKyw(pcKyw[i])) {
+         return CLPERR(psHdl,CLPERR_PAR,"Keyword for constant (%s) contains invalid character (%c)",pcKyw,pcKyw[i]);
+      }
+   }
+   if (i>CLPMAX_KYWLEN) {
+      return CLPERR(psHdl,CLPERR_PAR,"Keyword for constant (%s) is too long (>%d)",pcKyw,CLPMAX_KYWLEN);
+   }
+   if (siTyp!=CLPTYP_NUMBER && siTyp!=CLPTYP_FLOATN && siTyp!=CLPTYP_STRING) {
+      return CLPERR(psHdl,CLPERR_PAR,"Type (%d) of constant (%s) not supported",siTyp,pcKyw);
+   }
+   if (siTyp==CLPTYP_STRING && pcStr==NULL) {
+      return CLPERR(psHdl,CLPERR_PAR,"String value for constant (%s) is missing",pcKyw);
+   }
+   siIdx=siClpConFnd(psHdl,FALSE,pcKyw);
+   if (siIdx>=0 && siIdx<CLPCON_BLTCNT) {
+      return CLPERR(psHdl,CLPERR_SEM,"Constant (%s) is already predefined",pcKyw);
+   }
+   if (siIdx<0) {
+      if (psHdl->siCon>=psHdl->szCon) {
+         int szCon=(psHdl->szCon)?psHdl->szCon*2:CLPINI_CONCNT;
+         psCon=(TsCon*)realloc_nowarn(psHdl->psCon,sizeof(TsCon)*szCon);
+         if (psCon==NULL) {
+            return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for constant (%s) failed",pcKyw);
+         }
+         psHdl->psCon=psCon;
+         psHdl->szCon=szCon;
+      }
+      psCon=psHdl->psCon+psHdl->siCon;
+      memset(psCon,0,sizeof(TsCon));
+      pcHlp=(char*)malloc(strlen(pcKyw)+1);
+      if (pcHlp==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for constant (%s) failed",pcKyw);
+      }
+      psCon->pcKyw=strcpy(pcHlp,pcKyw);
+      psHdl->siCon++;
+      psHdl->uiCmk=0; // rebuild of the index at next lookup
+   } else {
+      psCon=psHdl->psCon+(siIdx-CLPCON_BLTCNT);
+      SAFE_FREE(psCon->pcStr);
+   }
+   psCon->siTyp=siTyp;
+   psCon->siKnd=(siTyp==CLPTYP_NUMBER)?CLPCON_NUM:(siTyp==CLPTYP_FLOATN)?CLPCON_FLT:CLPCON_STR;
+   psCon->siNum=siNum;
+   psCon->flNum=flNum;
+   if (siTyp==CLPTYP_STRING) {
+      pcHlp=(char*)malloc(strlen(pcStr)+1);
+      if (pcHlp==NULL) {
+         psCon->siKnd=CLPCON_NUM;
+         psCon->siTyp=CLPTYP_NUMBER;
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for string of constant (%s) failed",pcKyw);
+      }
+      psCon->pcStr=strcpy(pcHlp,pcStr);
+   }
+   for (i=0;i<psHdl->siVar;i++) { // compiled defaults can contain the old value
+      psHdl->psDfc[i].pcDft=NULL;
    }
    return(CLP_OK);
 }
@@ -2663,53 +3686,27 @@ extern void vdClpClose(
    if (pvHdl!=NULL) {
       TsHdl*                     psHdl=(TsHdl*)pvHdl;
       int                        i;
-      if (psHdl->pcLex!=NULL) {
-         free(psHdl->pcLex);
-         psHdl->pcLex=NULL;
-         psHdl->szLex=0;
-      }
-      if (psHdl->pcSrc!=NULL) {
-         free(psHdl->pcSrc);
-         psHdl->pcSrc=NULL;
-         psHdl->szSrc=0;
-      }
-      if (psHdl->pcPre!=NULL) {
-         free(psHdl->pcPre);
-         psHdl->pcPre=NULL;
-         psHdl->szPre=0;
-      }
-      if (psHdl->pcPat!=NULL) {
-         free(psHdl->pcPat);
-         psHdl->pcPat=NULL;
-         psHdl->szPat=0;
-      }
-      if (psHdl->pcLst!=NULL) {
-         free(psHdl->pcLst);
-         psHdl->pcLst=NULL;
-         psHdl->szLst=0;
-      }
-      if (psHdl->pcMsg!=NULL) {
-         free(psHdl->pcMsg);
-         psHdl->pcMsg=NULL;
-         psHdl->szMsg=0;
-      }
-      for (i=0;i<CLPMAX_BUFCNT;i++) {
+      vdClpPolPut(psHdl);
+      vdClpStmFre(psHdl,TRUE);
+      for (i=0;i<psHdl->szBuf;i++) {
          if (psHdl->apBuf[i]!=NULL) {
             free(psHdl->apBuf[i]);
             psHdl->apBuf[i]=NULL;
             psHdl->pzBuf[i]=0;
          }
       }
-      if (psHdl->psTab!=NULL) {
-         uint64_t uiCnt=0;
-         uint64_t uiSiz=0;
-         vdClpSymDel(psHdl->psTab,&uiCnt,&uiSiz);
-         if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
-            char acTs[24];
-            fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Amount(%"PRIu64"),Size(%"PRIu64")) in vdClpClose()\n",cstime(0,acTs),uiCnt,uiSiz);
-         }
-         psHdl->psTab=NULL;
+      SAFE_FREE(psHdl->apBuf);
+      SAFE_FREE(psHdl->pzBuf);
+      psHdl->szBuf=0;
+      psHdl->siBuf=0;
+      if (psHdl->psSav!=NULL) {
+         free(psHdl->psSav);
+         psHdl->psSav=NULL;
+         psHdl->szSav=0;
+         psHdl->siSav=0;
       }
+      vdClpConFre(psHdl);
+      vdClpTplRel(psHdl,"in vdClpClose()");
 
       switch (siMtd) {
       case CLPCLS_MTD_KEP:
@@ -2720,6 +3717,10 @@ extern void vdClpClose(
             psHdl->psPtr=NULL;
             psHdl->szPtr=0;
             psHdl->siPtr=0;
+            free(psHdl->piPix);
+            psHdl->piPix=NULL;
+            psHdl->szPix=0;
+            psHdl->siPix=0;
          }
          free(psHdl);
          break;
@@ -2730,6 +3731,10 @@ extern void vdClpClose(
             psHdl->psPtr=NULL;
             psHdl->szPtr=0;
             psHdl->siPtr=0;
+            free(psHdl->piPix);
+            psHdl->piPix=NULL;
+            psHdl->szPix=0;
+            psHdl->siPix=0;
          }
          free(psHdl);
          break;
@@ -2737,6 +3742,60 @@ extern void vdClpClose(
    }
 }
 
+extern void* pvClpCloseBlk(
+   void*                         pvHdl,
+   size_t*                       pzBlk)
+{
+   TsHdl*                        psHdl=(TsHdl*)pvHdl;
+   char*                         pcBlk=NULL;
+   size_t                        szBlk=0;
+   if (psHdl!=NULL && psHdl->siPtr) {
+      size_t*                    pzOfs=(size_t*)calloc(psHdl->siPtr,sizeof(size_t));
+      int                        i;
+      if (pzOfs!=NULL) {
+         for (i=0;i<psHdl->siPtr;i++) { // offset+1 in the block for each buffer still referenced by the CLP structure
+            const TsPtr* psPtr=psHdl->psPtr+i;
+            if (psPtr->pvPtr!=NULL && !psPtr->isTmp && (psPtr->ppRef!=NULL || psPtr->siPar>=0)) {
+               if (psPtr->siPar<0 || (psPtr->siPar<psHdl->siPtr && psHdl->psPtr[psPtr->siPar].pvPtr!=NULL)) {
+                  if (*ppClpPtrRef(psHdl,psPtr)==psPtr->pvPtr) {
+                     pzOfs[i]=szBlk+1;
+                     szBlk+=(psPtr->siSiz+15)&~15;
+                  }
+               }
+            }
+         }
+         if (szBlk) {
+            pcBlk=(char*)malloc(szBlk);
+         }
+         if (pcBlk!=NULL) {
+            for (i=0;i<psHdl->siPtr;i++) {
+               if (pzOfs[i]) {
+                  memcpy(pcBlk+pzOfs[i]-1,psHdl->psPtr[i].pvPtr,psHdl->psPtr[i].siSiz);
+               }
+            }
+            for (i=0;i<psHdl->siPtr;i++) { // the pointer is rewritten in the block if the parent was moved
+               if (pzOfs[i]) {
+                  const TsPtr* psPtr=psHdl->psPtr+i;
+                  void**       ppRef=(psPtr->siPar>=0 && pzOfs[psPtr->siPar])?(void**)(pcBlk+pzOfs[psPtr->siPar]-1+psPtr->siOfs):ppClpPtrRef(psHdl,psPtr);
+                  *ppRef=pcBlk+pzOfs[i]-1;
+               }
+            }
+            for (i=0;i<psHdl->siPtr;i++) {
+               if (pzOfs[i] || psHdl->psPtr[i].isTmp) {
+                  pvClpAllocAgain(psHdl->psPtr+i,0,0);
+               }
+            }
+         } else {
+            szBlk=0;
+         }
+         free(pzOfs);
+      }
+   }
+   vdClpClose(pvHdl,CLPCLS_MTD_EXC);
+   if (pzBlk!=NULL) { *pzBlk=szBlk; }
+   return(pcBlk);
+}
+
 /* Interne Funktionen *************************************************/
 
 static const char* get_env(char* var,const size_t size,const char* fmtstr, ...)
@@ -2756,17 +3815,182 @@ static const char* get_env(char* var,const size_t size,const char* fmtstr, ...)
    return(GETENV(var));
 }
 
+static int siClpSymVar(
+   TsHdl*                        psHdl)
+{
+   TsTpl*                        psTpl=psHdl->psTpl;
+   if (psTpl->siVar>=psTpl->szVar) {
+      int                        szVar=(psTpl->szVar)?psTpl->szVar*2:CLPINI_VARCNT;
+      void*                      pvHlp;
+      pvHlp=realloc_nowarn(psTpl->psVar,sizeof(TsVar)*szVar);
+      if (pvHlp==NULL) return(-1);
+      psTpl->psVar=(TsVar*)pvHlp;
+      pvHlp=realloc_nowarn(psTpl->psPro,sizeof(TsPro)*szVar);
+      if (pvHlp==NULL) return(-1);
+      psTpl->psPro=(TsPro*)pvHlp;
+      memset(psTpl->psVar+psTpl->szVar,0,sizeof(TsVar)*(szVar-psTpl->szVar));
+      memset(psTpl->psPro+psTpl->szVar,0,sizeof(TsPro)*(szVar-psTpl->szVar));
+      psTpl->szVar=szVar;
+   }
+   return(psTpl->siVar++);
+}
+
+static void vdClpSymCon(
+   TsHdl*                        psHdl,
+   const TsSym*                  psSym)
+{
+   TsVar*                        psVar=INIVAR(psHdl,psSym);
+   switch (psSym->psFix->siTyp) {
+   case CLPTYP_NUMBER: psVar->pvDat=(void*)&psSym->psArg->siVal; break;
+   case CLPTYP_FLOATN: psVar->pvDat=(void*)&psSym->psArg->flVal; break;
+   case CLPTYP_STRING: psVar->pvDat=(void*)psSym->psArg->pcVal;  break;
+   }
+   psVar->pvPtr=NULL;
+   psVar->siLen=psSym->psFix->siSiz;
+   psVar->siCnt=1;
+   psVar->siRst=0;
+}
+
+static int siClpVarExt(
+   TsHdl*                        psHdl)
+{
+   TsTpl*                        psTpl=psHdl->psTpl;
+   if (psHdl->siVar<psTpl->siVar) {
+      if (psHdl->szVar<psTpl->siVar) {
+         void*                   pvHlp;
+         pvHlp=realloc_nowarn(psHdl->psVar,sizeof(TsVar)*psTpl->szVar);
+         if (pvHlp==NULL) {
+            return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol variables failed");
+         }
+         psHdl->psVar=(TsVar*)pvHlp;
+         pvHlp=realloc_nowarn(psHdl->psPro,sizeof(TsPro)*psTpl->szVar);
+         if (pvHlp==NULL) {
+            return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol properties failed");
+         }
+         psHdl->psPro=(TsPro*)pvHlp;
+         pvHlp=realloc_nowarn(psHdl->psDfc,sizeof(TsDfc)*psTpl->szVar);
+         if (pvHlp==NULL) {
+            return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for compiled defaults failed");
+         }
+         psHdl->psDfc=(TsDfc*)pvHlp;
+         memset(psHdl->psDfc+psHdl->szVar,0,sizeof(TsDfc)*(psTpl->szVar-psHdl->szVar));
+         psHdl->szVar=psTpl->szVar;
+      }
+      memcpy(psHdl->psVar+psHdl->siVar,psTpl->psVar+psHdl->siVar,sizeof(TsVar)*(psTpl->siVar-psHdl->siVar));
+      memcpy(psHdl->psPro+psHdl->siVar,psTpl->psPro+psHdl->siVar,sizeof(TsPro)*(psTpl->siVar-psHdl->siVar));
+      psHdl->siVar=psTpl->siVar;
+   }
+   return(CLP_OK);
+}
+
+static void vdClpVarDel(
+   TsHdl*                        psHdl)
+{
+   int                           i;
+   if (psHdl->psPro!=NULL) {
+      for (i=0;i<psHdl->siVar;i++) {
+         if (psHdl->psPro[i].pcPro!=psHdl->psTpl->psPro[i].pcPro) SAFE_FREE(psHdl->psPro[i].pcPro);
+         if (psHdl->psPro[i].pcSrc!=psHdl->psTpl->psPro[i].pcSrc) SAFE_FREE(psHdl->psPro[i].pcSrc);
+      }
+   }
+   if (psHdl->psDfc!=NULL) {
+      for (i=0;i<psHdl->szVar;i++) {
+         SAFE_FREE(psHdl->psDfc[i].psVal);
+         SAFE_FREE(psHdl->psDfc[i].pcBuf);
+      }
+   }
+   SAFE_FREE(psHdl->psVar);
+   SAFE_FREE(psHdl->psPro);
+   SAFE_FREE(psHdl->psDfc);
+   SAFE_FREE(psHdl->puDfl);
+   psHdl->siVar=0;
+   psHdl->szVar=0;
+   psHdl->szDfl=0;
+}
+
+/* Flags determined while parsing (e.g. TIM for a time literal) are kept per symbol and handle, because
+ * an alias shares the value and property slot of its target and the symbol table can be shared.
+ * The array grows on demand, without memory the flag is lost (it only changes the argument list).*/
+static void vdClpDflSet(
+   TsHdl*                        psHdl,
+   const TsSym*                  psSym,
+   const unsigned int            uiFlg)
+{
+   if (psSym->siSid>=psHdl->szDfl) {
+      int                        szDfl=(psHdl->psTpl->siSym>psSym->siSid)?(int)psHdl->psTpl->siSym:psSym->siSid+1;
+      unsigned int*              puDfl=(unsigned int*)realloc_nowarn(psHdl->puDfl,sizeof(unsigned int)*szDfl);
+      if (puDfl==NULL) return;
+      memset(puDfl+psHdl->szDfl,0,sizeof(unsigned int)*(szDfl-psHdl->szDfl));
+      psHdl->puDfl=puDfl;
+      psHdl->szDfl=szDfl;
+   }
+   psHdl->puDfl[psSym->siSid]|=uiFlg;
+}
+
+static void vdClpDfcRst(
+   TsHdl*                        psHdl,
+   const TsSym*                  psArg)
+{
+   TsDfc*                        psDfc=psHdl->psDfc+psArg->siVar;
+   psDfc->pcDft=NULL;
+   psDfc->isDyn=FALSE;
+   psDfc->siVal=0;
+   psDfc->siBuf=0;
+}
+
+static int siClpSymEnv(
+   TsHdl*                        psHdl,
+   const char*                   pcPat,
+   const TsClpArgument*          psArg,
+   TsPro*                        psPro)
+{
+   const char*                   pcEnv=NULL;
+   char                          acVar[strlen(psHdl->pcOwn)+strlen(psHdl->pcPgm)+strlen(pcPat)+strlen(psArg->pcKyw)+4];
+   acVar[0]=0x00;
+   if (CLPISF_ARG(psArg->uiFlg)) {
+      pcEnv=get_env(acVar,sizeof(acVar),"%s.%s.%s.%s",psHdl->pcOwn,psHdl->pcPgm,pcPat,psArg->pcKyw);
+      if (pcEnv==NULL) {
+         pcEnv=get_env(acVar,sizeof(acVar),"%s.%s.%s",psHdl->pcPgm,pcPat,psArg->pcKyw);
+         if (pcEnv==NULL) {
+            pcEnv=get_env(acVar,sizeof(acVar),"%s.%s",pcPat,psArg->pcKyw);
+         }
+      }
+   }
+   if (pcEnv!=NULL && *pcEnv) {
+      psPro->pcPro=malloc(strlen(pcEnv)+1);
+      if (psPro->pcPro==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element property '%s.%s' failed",pcPat,psArg->pcKyw);
+      }
+      strcpy(psPro->pcPro,pcEnv);
+      psPro->pcDft=psPro->pcPro;
+      const size_t szSrc=strlen(CLPSRC_ENV)+strlen(acVar)+1;
+      psPro->pcSrc=malloc(szSrc);
+      if (psPro->pcSrc==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element source '%s.%s' failed",pcPat,psArg->pcKyw);
+      }
+      snprintf(psPro->pcSrc,szSrc,"%s%s",CLPSRC_ENV,acVar);
+      psPro->siRow=1;
+   } else {
+      psPro->pcDft=psArg->pcDft;
+      if (psArg->pcDft!=NULL) {
+         const size_t szSrc=strlen(CLPSRC_DEF)+strlen(pcPat)+strlen(psArg->pcKyw)+2;
+         psPro->pcSrc=malloc(szSrc);
+         if (psPro->pcSrc==NULL) {
+            return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element source '%s.%s' failed",pcPat,psArg->pcKyw);
+         }
+         snprintf(psPro->pcSrc,szSrc,"%s%s.%s",CLPSRC_DEF,pcPat,psArg->pcKyw);
+         psPro->siRow=1;
+      }
+   }
+   return(CLP_OK);
+}
+
 #undef  ERROR
 #define ERROR(s) do {\
-   if ((s)!=NULL) {                                                                       \
-      if ((s)->psStd!=NULL) { free((s)->psStd); (s)->psStd=NULL; }                        \
-      if ((s)->psFix!=NULL) {                                                             \
-         if ((s)->psFix->pcPro!=NULL) { free((s)->psFix->pcPro); (s)->psFix->pcPro=NULL; }\
-         if ((s)->psFix->pcSrc!=NULL) { free((s)->psFix->pcSrc); (s)->psFix->pcSrc=NULL; }\
-         free((s)->psFix); (s)->psFix=NULL;                                               \
-      }                                                                                   \
-      if ((s)->psVar!=NULL) { free((s)->psVar); (s)->psVar=NULL; }                        \
-      free(s);\
+   if ((s)!=NULL && (s)->psStd!=NULL && (s)->psStd->psAli==NULL && (s)->siVar>=0) {       \
+      TsPro* psPro=INIPRO(psHdl,(s));                                                      \
+      if (psPro->pcPro!=NULL) { free(psPro->pcPro); psPro->pcPro=NULL; }                   \
+      if (psPro->pcSrc!=NULL) { free(psPro->pcSrc); psPro->pcSrc=NULL; }                   \
    } return NULL;\
 } while (0)
 
@@ -2782,19 +4006,16 @@ static TsSym* psClpSymIns(
 {
    TsSym*                        psSym;
    TsSym*                        psHlp;
-   const char*                   pcEnv=NULL;
    const char*                   pcPat=fpcPat(psHdl,siLev);
-   char                          acVar[strlen(psHdl->pcOwn)+strlen(psHdl->pcPgm)+strlen(pcPat)+strlen(psArg->pcKyw)+4];
-   acVar[0]=0x00;
-   psSym=(TsSym*)calloc(1,sizeof(TsSym));
+   psSym=(TsSym*)pvClpSymAlc(psHdl,sizeof(TsSym));
    if (psSym==NULL) {
       CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol '%s.%s' failed",pcPat,psArg->pcKyw);
       ERROR(psSym);
    }
-   psSym->psStd=(TsStd*)calloc(1,sizeof(TsStd));
-   psSym->psFix=(TsFix*)calloc(1,sizeof(TsFix));
-   psSym->psVar=(TsVar*)calloc(1,sizeof(TsVar));
-   if (psSym->psStd==NULL || psSym->psFix==NULL || psSym->psVar==NULL) {
+   psSym->siVar=-1;
+   psSym->psStd=(TsStd*)pvClpSymAlc(psHdl,sizeof(TsStd));
+   psSym->psFix=(TsFix*)pvClpSymAlc(psHdl,sizeof(TsFix));
+   if (psSym->psStd==NULL || psSym->psFix==NULL) {
       CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element '%s.%s' failed",pcPat,psArg->pcKyw);
       ERROR(psSym);
    }
@@ -2844,44 +4065,15 @@ static TsSym* psClpSymIns(
 #endif
    psSym->psFix->pcMan=psArg->pcMan;
    psSym->psFix->pcHlp=psArg->pcHlp;
-   pcEnv=NULL;
-   if (CLPISF_ARG(psArg->uiFlg)) {
-      pcEnv=get_env(acVar,sizeof(acVar),"%s.%s.%s.%s",psHdl->pcOwn,psHdl->pcPgm,pcPat,psArg->pcKyw);
-      if (pcEnv==NULL) {
-         pcEnv=get_env(acVar,sizeof(acVar),"%s.%s.%s",psHdl->pcPgm,pcPat,psArg->pcKyw);
-         if (pcEnv==NULL) {
-            pcEnv=get_env(acVar,sizeof(acVar),"%s.%s",pcPat,psArg->pcKyw);
-         }
-      }
-   }
-   if (pcEnv!=NULL && *pcEnv) {
-      psSym->psFix->pcPro=malloc(strlen(pcEnv)+1);
-      if (psSym->psFix->pcPro==NULL) {
-         CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element property '%s.%s' failed",pcPat,psArg->pcKyw);
+   if (psArg->pcAli==NULL) {
+      psSym->siVar=siClpSymVar(psHdl);
+      if (psSym->siVar<0) {
+         CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol variable '%s.%s' failed",pcPat,psArg->pcKyw);
          ERROR(psSym);
       }
-      strcpy(psSym->psFix->pcPro,pcEnv);
-      psSym->psFix->pcDft=psSym->psFix->pcPro;
-      const size_t szSrc=strlen(CLPSRC_ENV)+strlen(acVar)+1;
-      psSym->psFix->pcSrc=malloc(szSrc);
-      if (psSym->psFix->pcSrc==NULL) {
-         CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element source '%s.%s' failed",pcPat,psArg->pcKyw);
+      if (siClpSymEnv(psHdl,pcPat,psArg,INIPRO(psHdl,psSym))<0) {
          ERROR(psSym);
       }
-      snprintf(psSym->psFix->pcSrc,szSrc,"%s%s",CLPSRC_ENV,acVar);
-      psSym->psFix->siRow=1;
-   } else {
-      psSym->psFix->pcDft=psArg->pcDft;
-      if (psArg->pcDft!=NULL) {
-         const size_t szSrc=strlen(CLPSRC_DEF)+strlen(pcPat)+strlen(psArg->pcKyw)+2;
-         psSym->psFix->pcSrc=malloc(szSrc);
-         if (psSym->psFix->pcSrc==NULL) {
-            CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol element source '%s.%s' failed",pcPat,psArg->pcKyw);
-            ERROR(psSym);
-         }
-         snprintf(psSym->psFix->pcSrc,szSrc,"%s%s.%s",CLPSRC_DEF,pcPat,psArg->pcKyw);
-         psSym->psFix->siRow=1;
-      }
    }
    psSym->psFix->siTyp=psArg->siTyp;
    psSym->psFix->siMin=psArg->siMin;
@@ -2942,8 +4134,8 @@ static TsSym* psClpSymIns(
             if (k==0) {
                psSym->psStd->psAli=psHlp;
                psSym->psStd->uiFlg=psHlp->psStd->uiFlg|psArg->uiFlg|CLPFLG_ALI;
-               free(psSym->psFix); psSym->psFix=psHlp->psFix;
-               free(psSym->psVar); psSym->psVar=psHlp->psVar;
+               psSym->psFix=psHlp->psFix;
+               psSym->siVar=psHlp->siVar;
             } else {
                CLPERR(psHdl,CLPERR_TAB,"Alias '%s' for keyword '%s.%s' is not unique",psArg->pcAli,pcPat,psSym->psStd->pcKyw);
                ERROR(psSym);
@@ -2982,8 +4174,8 @@ static TsSym* psClpSymIns(
          CLPERR(psHdl,CLPERR_TAB,"Alias (%s) for link '%s.%s' defined",psArg->pcAli,pcPat,psSym->psStd->pcKyw);
          ERROR(psSym);
       }
-      if (psSym->psFix->pcDft!=NULL) {
-         CLPERR(psHdl,CLPERR_TAB,"Default (%s) for link '%s.%s' defined",psSym->psFix->pcDft,pcPat,psSym->psStd->pcKyw);
+      if (INIPRO(psHdl,psSym)->pcDft!=NULL) {
+         CLPERR(psHdl,CLPERR_TAB,"Default (%s) for link '%s.%s' defined",INIPRO(psHdl,psSym)->pcDft,pcPat,psSym->psStd->pcKyw);
          ERROR(psSym);
       }
       if (psSym->psFix->siTyp!=CLPTYP_NUMBER) {
@@ -3012,8 +4204,8 @@ static TsSym* psClpSymIns(
          CLPERR(psHdl,CLPERR_TAB,"Alias (%s) for constant '%s.%s' defined",psArg->pcAli,pcPat,psSym->psStd->pcKyw);
          ERROR(psSym);
       }
-      if (psSym->psFix->pcDft!=NULL) {
-         CLPERR(psHdl,CLPERR_TAB,"Default (%s) for constant '%s.%s' defined",psSym->psFix->pcDft,pcPat,psSym->psStd->pcKyw);
+      if (INIPRO(psHdl,psSym)->pcDft!=NULL) {
+         CLPERR(psHdl,CLPERR_TAB,"Default (%s) for constant '%s.%s' defined",INIPRO(psHdl,psSym)->pcDft,pcPat,psSym->psStd->pcKyw);
          ERROR(psSym);
       }
       if (psArg->psTab!=NULL) {
@@ -3035,11 +4227,9 @@ static TsSym* psClpSymIns(
       switch (psSym->psFix->siTyp) {
       case CLPTYP_NUMBER:
          psSym->psFix->siSiz=sizeof(psArg->siVal);
-         psSym->psVar->pvDat=(void*)&psArg->siVal;
          break;
       case CLPTYP_FLOATN:
          psSym->psFix->siSiz= sizeof(psArg->flVal);
-         psSym->psVar->pvDat=(void*)&psArg->flVal;
          break;
       case CLPTYP_STRING:
          if (psArg->pcVal==NULL) {
@@ -3049,16 +4239,12 @@ static TsSym* psClpSymIns(
          if (!CLPISF_BIN(psSym->psStd->uiFlg) && psSym->psFix->siSiz==0) {
             psSym->psFix->siSiz=strlen((const char*)psArg->pcVal)+1;
          }
-         psSym->psVar->pvDat=(void*)psArg->pcVal;
          break;
       default:
          CLPERR(psHdl,CLPERR_TAB,"Type (%s) for argument '%s.%s' not supported for constant definitions",pcMapClpTyp(psSym->psFix->siTyp),pcPat,psSym->psStd->pcKyw);
          ERROR(psSym);
       }
-      psSym->psVar->pvPtr=NULL;
-      psSym->psVar->siLen=psSym->psFix->siSiz;
-      psSym->psVar->siCnt=1;
-      psSym->psVar->siRst=0;
+      vdClpSymCon(psHdl,psSym);
    } else {
       CLPERR(psHdl,CLPERR_TAB,"Kind (ALI/ARG/LNK/CON) of argument '%s.%s' not determinable",pcPat,psSym->psStd->pcKyw);
       ERROR(psSym);
@@ -3144,7 +4330,7 @@ static TsSym* psClpSymIns(
    }
    psSym->psDep=NULL;
    psSym->psHih=psHih;
-   psHdl->siSym++;
+   psSym->siSid=(int)psHdl->psTpl->siSym++;
    return(psSym);
 }
 #undef ERROR
@@ -3159,6 +4345,7 @@ static int siClpSymIni(
 {
    int                           siErr;
    TsSym*                        psCur=NULL;
+   TsSym*                        psFst=NULL;
    int                           i,j;
 
    if (psTab==NULL) {
@@ -3170,14 +4357,6 @@ static int siClpSymIni(
    }
 
    for (j=i=0;psTab[i].siTyp;i++) {
-      if (i>=CLPMAX_TABCNT) {
-         if (psArg==NULL) {
-            return CLPERR(psHdl,CLPERR_TAB,"Argument table bigger than maximal supported entry count (%d)",CLPMAX_TABCNT);
-         } else {
-            return CLPERR(psHdl,CLPERR_TAB,"Table for key word (%s:%s) bigger than maximal supported entry count (%d)",fpcPat(psHdl,siLev),psArg->pcKyw,CLPMAX_TABCNT);
-         }
-      }
-
       if (psTab[i].pcKyw==NULL || psTab[i].pcKyw[0]==0x00) {
          if (psArg==NULL) {
             return CLPERR(psHdl,CLPERR_TAB,"There is no keyword defined in argument table at index %d",i);
@@ -3199,7 +4378,10 @@ static int siClpSymIni(
          if (psCur==NULL) {
             return CLPERR(psHdl,CLPERR_SYS,"Insert of symbol (%s.%s) in symbol table failed",fpcPat(psHdl,siLev),psTab[i].pcKyw);
          }
-         if (j==0 && ppFst!=NULL) { (*ppFst)=psCur; }
+         if (j==0) {
+            psFst=psCur;
+            if (ppFst!=NULL) { (*ppFst)=psCur; }
+         }
 
          switch (psTab[i].siTyp) {
          case CLPTYP_SWITCH:
@@ -3213,12 +4395,8 @@ static int siClpSymIni(
          case CLPTYP_NUMBER:
          case CLPTYP_FLOATN:
          case CLPTYP_STRING:
-            if (CLPISF_SEL(psTab[i].uiFlg)) {
-               psHdl->apPat[siLev]=psCur;
-               siErr=siClpSymIni(psHdl,siLev+1,psTab+i,psTab[i].psTab,psCur,NULL);
-               if (siErr<0) { return(siErr); }
-            } else {
-               if (psTab[i].psTab!=NULL) {
+            if (psHdl->isFul || (CLPISF_SEL(psTab[i].uiFlg) && psTab[i].psTab==NULL)) {
+               if (CLPISF_SEL(psTab[i].uiFlg) || psTab[i].psTab!=NULL) {
                   psHdl->apPat[siLev]=psCur;
                   siErr=siClpSymIni(psHdl,siLev+1,psTab+i,psTab[i].psTab,psCur,NULL);
                   if (siErr<0) { return(siErr); }
@@ -3241,38 +4419,147 @@ static int siClpSymIni(
          j++;
       }
    }
-   return(CLP_OK);
+   return(siClpSymIdx(psHdl,siLev,psArg,psFst));
 }
 
-static int siClpSymLnkCnt(
-   TsHdl*            psHdl,
-   int               siLev,
-   TsSym*            psSym,
-   TsSym*            psLnk)
+/* The keys of the sorted index carry their first 8 bytes as big-endian integer, so the binary search and the
+ * prefix scan compare integers and read the key string only for keywords longer than 8 bytes */
+static inline U64 ClpKyxPfx(const char* pcKey)
 {
-   TsSym*            psSon;
-   int siErr=siExtentSymTab(psHdl,siLev,psSym);
-   if (siErr<0) { return(siErr); }
-   for (psSon=psSym->psDep; psSon!=NULL; psSon=psSon->psNxt) {
-      if (psSon->psFix->siTyp==CLPTYP_OVRLAY) {
-         psSon->psFix->psCnt=psLnk;
-         siErr=siClpSymLnkCnt(psHdl,siLev+1,psSon,psLnk);
-         if (siErr<0) { return(siErr); }
-      }
+   U64 uiPfx=0;
+   int i;
+   for (i=0;i<8 && pcKey[i]!=EOS;i++) { uiPfx|=((U64)(unsigned char)pcKey[i])<<(56-8*i); }
+   return(uiPfx);
+}
+
+static int siClpKyxKey(
+   TsHdl*                        psHdl,
+   const char*                   pcKyw,
+   char*                         pcKey)
+{
+   int                           l;
+   for (l=0;pcKyw[l]!=EOS;l++) {
+      if (l>=CLPMAX_KYWLEN) { return(-1); } // longer than each keyword
+      pcKey[l]=(psHdl->isCas)?pcKyw[l]:toupper(pcKyw[l]);
    }
-   return(CLP_OK);
+   pcKey[l]=EOS;
+   return(l);
 }
 
-static int siClpSymLnkOid(
-   TsHdl*            psHdl,
-   int               siLev,
-   TsSym*            psSym,
-   TsSym*            psLnk)
+static int siClpKyxLow(
+   const TsIdx*                  psIdx,
+   const char*                   pcKey,
+   const U64                     uiPfx,
+   const int                     siLen)
 {
-   TsSym*            psSon;
-   int siErr=siExtentSymTab(psHdl,siLev,psSym);
-   if (siErr<0) { return(siErr); }
-   for (psSon=psSym->psDep; psSon!=NULL; psSon=psSon->psNxt) {
+   int                           m,lo,hi;
+   for (lo=0,hi=psIdx->siCnt;lo<hi;) { // compare the 8 byte prefix first and the string only if they are equal
+      const TsKyx* psKyx=psIdx->asKyx+(m=(lo+hi)/2);
+      if (psKyx->uiPfx<uiPfx || (psKyx->uiPfx==uiPfx && siLen>8 && strcmp(psKyx->pcKey,pcKey)<0)) { lo=m+1; } else { hi=m; }
+   }
+   return(lo);
+}
+
+static int siClpKyxCmp(
+   const void*                   pvKy1,
+   const void*                   pvKy2)
+{
+   return(strcmp(((const TsKyx*)pvKy1)->pcKey,((const TsKyx*)pvKy2)->pcKey));
+}
+
+static int siClpSymIdx(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   const TsClpArgument*          psArg,
+   TsSym*                        psTab)
+{
+   TsSym*                        psSym;
+   TsIdx*                        psIdx;
+   int                           siCnt,siPos,siElm;
+
+   if (psTab==NULL) { return(CLP_OK); }
+   for (siCnt=siPos=0,psSym=psTab;psSym!=NULL;psSym=psSym->psNxt,siPos++) {
+      if (!CLPISF_LNK(psSym->psStd->uiFlg)) { siCnt++; }
+   }
+   psIdx=(TsIdx*)pvClpSymAlc(psHdl,sizeof(TsIdx)+siCnt*sizeof(TsKyx));
+   if (psIdx==NULL) {
+      if (psArg==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for keyword index of argument table failed%s","");
+      } else {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for keyword index of table '%s.%s' failed",fpcPat(psHdl,siLev),psArg->pcKyw);
+      }
+   }
+   psIdx->siEnt=siPos;
+   for (siPos=siElm=0,psSym=psTab;psSym!=NULL;psSym=psSym->psNxt,siPos++) {
+      psSym->psIdx=psIdx;
+      psSym->siPos=siPos;
+      if (!CLPISF_LNK(psSym->psStd->uiFlg)) {
+         TsKyx* psKyx=psIdx->asKyx+psIdx->siCnt;
+         if (psHdl->isCas) {
+            psKyx->pcKey=psSym->psStd->pcKyw;
+         } else {
+            char* pcKey=(char*)pvClpSymAlc(psHdl,strlen(psSym->psStd->pcKyw)+1);
+            if (pcKey==NULL) {
+               return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for index key of keyword '%s.%s' failed",fpcPat(psHdl,siLev),psSym->psStd->pcKyw);
+            }
+            for (int i=0;(pcKey[i]=toupper(psSym->psStd->pcKyw[i]))!=EOS;i++);
+            psKyx->pcKey=pcKey;
+         }
+         psKyx->uiPfx=ClpKyxPfx(psKyx->pcKey);
+         psKyx->psSym=psSym;
+         psKyx->siPos=siPos;
+         psKyx->siElm=siElm;
+         psIdx->siCnt++;
+         if (CLPISF_ARG(psSym->psStd->uiFlg) || CLPISF_CON(psSym->psStd->uiFlg)) {
+            siElm++;
+         }
+      }
+   }
+   qsort(psIdx->asKyx,psIdx->siCnt,sizeof(TsKyx),siClpKyxCmp);
+   return(CLP_OK);
+}
+
+static void vdClpIdxKwl(
+   TsSym*                        psTab)
+{
+   TsIdx*                        psIdx;
+   int                           i;
+   if (psTab==NULL || psTab->psIdx==NULL) { return; }
+   psIdx=(TsIdx*)psTab->psIdx;
+   for (i=0;i<psIdx->siCnt;i++) {
+      psIdx->asKyx[i].siKwl=psIdx->asKyx[i].psSym->psStd->siKwl;
+   }
+}
+
+static int siClpSymLnkCnt(
+   TsHdl*            psHdl,
+   int               siLev,
+   TsSym*            psSym,
+   TsSym*            psLnk)
+{
+   TsSym*            psSon;
+   int siErr=siExtentSymTab(psHdl,siLev,psSym);
+   if (siErr<0) { return(siErr); }
+   for (psSon=psSym->psDep; psSon!=NULL; psSon=psSon->psNxt) {
+      if (psSon->psFix->siTyp==CLPTYP_OVRLAY) {
+         psSon->psFix->psCnt=psLnk;
+         siErr=siClpSymLnkCnt(psHdl,siLev+1,psSon,psLnk);
+         if (siErr<0) { return(siErr); }
+      }
+   }
+   return(CLP_OK);
+}
+
+static int siClpSymLnkOid(
+   TsHdl*            psHdl,
+   int               siLev,
+   TsSym*            psSym,
+   TsSym*            psLnk)
+{
+   TsSym*            psSon;
+   int siErr=siExtentSymTab(psHdl,siLev,psSym);
+   if (siErr<0) { return(siErr); }
+   for (psSon=psSym->psDep; psSon!=NULL; psSon=psSon->psNxt) {
       if (psSon->psFix->siTyp==CLPTYP_OVRLAY) {
          psSon->psFix->psOid=psLnk;
          siErr=siClpSymLnkOid(psHdl,siLev+1,psSon,psLnk);
@@ -3366,10 +4653,16 @@ static int siClpSymCal(
 {
    TsSym*                        psSym;
    TsSym*                        psHlp=NULL;
+   const TsIdx*                  psIdx=(psTab!=NULL)?psTab->psIdx:NULL;
+   char                          acKey[CLPMAX_KYWSIZ];
+   U64                           uiPfx;
    int                           isPar=FALSE;
    int                           isCon=FALSE;
    int                           siCon=0;
-   int                           siErr,siPos,k,h;
+   int                           siErr,siPos,k,h,j;
+
+   siErr=siClpSymKwl(psHdl,siLev,psTab);
+   if (siErr<0) { return(siErr); }
 
    for (siPos=0,psSym=psTab;psSym!=NULL;psSym=psSym->psNxt,siPos++) {
 #ifdef __DEBUG__
@@ -3387,8 +4680,11 @@ static int siClpSymCal(
          isPar=TRUE;
       } else if (CLPISF_LNK(psSym->psStd->uiFlg)) {
          isPar=TRUE;
-         for (h=k=0,psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
-            if (CLPISF_ARG(psHlp->psStd->uiFlg) && strxcmp(psHdl->isCas,psSym->psStd->pcKyw,psHlp->psStd->pcKyw,0,0,FALSE)==0) {
+         j=(psIdx!=NULL)?siClpKyxKey(psHdl,psSym->psStd->pcKyw,acKey):-1;
+         uiPfx=(j>=0)?ClpKyxPfx(acKey):0;
+         for (h=k=0,j=(j>=0)?siClpKyxLow(psIdx,acKey,uiPfx,j):INT_MAX;psIdx!=NULL && j<psIdx->siCnt && psIdx->asKyx[j].uiPfx==uiPfx && strcmp(psIdx->asKyx[j].pcKey,acKey)==0;j++) {
+            psHlp=psIdx->asKyx[j].psSym;
+            if (CLPISF_ARG(psHlp->psStd->uiFlg)) {
                psSym->psFix->psLnk=psHlp; h++;
                if (CLPISF_CNT(psSym->psStd->uiFlg)) {
                   psHlp->psFix->psCnt=psSym; k++;
@@ -3452,33 +4748,6 @@ static int siClpSymCal(
          return CLPERR(psHdl,CLPERR_TAB,"Kind (ALI/ARG/LNK/CON) of argument '%s.%s' not determinable",fpcPat(psHdl,siLev),psSym->psStd->pcKyw);
       }
 
-      psSym->psStd->siKwl=strlen(psSym->psStd->pcKyw);
-      if (psHdl->siMkl>0) {
-         if (psSym->psStd->siKwl>psHdl->siMkl) { psSym->psStd->siKwl=psHdl->siMkl; }
-         if (!CLPISF_LNK(psSym->psStd->uiFlg)) {
-            for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
-               if (psHlp!=psSym && !CLPISF_LNK(psHlp->psStd->uiFlg)) {
-                  if (psHdl->isCas) {
-                     for (k=0;psSym->psStd->pcKyw[k] && psHlp->psStd->pcKyw[k] &&         psSym->psStd->pcKyw[k] ==        psHlp->psStd->pcKyw[k] ;k++) {}
-                  } else {
-                     for (k=0;psSym->psStd->pcKyw[k] && psHlp->psStd->pcKyw[k] && toupper(psSym->psStd->pcKyw[k])==toupper(psHlp->psStd->pcKyw[k]);k++) {}
-                  }
-                  if (psSym->psStd->pcKyw[k]==0 && psHlp->psStd->pcKyw[k]==0) {
-                     return CLPERR(psHdl,CLPERR_TAB,"Key word '%s.%s' is not unique",fpcPat(psHdl,siLev),psSym->psStd->pcKyw);
-                  }
-                  if (psSym->psStd->pcKyw[k]==0) {
-                     psSym->psStd->siKwl=k;
-                     if (psHlp->psStd->siKwl<=k) { psHlp->psStd->siKwl=k+1; }
-                  } else if (psHlp->psStd->pcKyw[k]==0) {
-                     psHlp->psStd->siKwl=k;
-                     if (psSym->psStd->siKwl<=k) { psSym->psStd->siKwl=k+1; }
-                  } else {
-                     if (psSym->psStd->siKwl<=k) { psSym->psStd->siKwl=k+1; }
-                  }
-               }
-            }
-         }
-      }
       if (psSym->psDep!=NULL) {
          psHdl->apPat[siLev]=psSym;
          siErr=siClpSymCal(psHdl,siLev+1,psSym,psSym->psDep);
@@ -3526,6 +4795,37 @@ static int siClpSymCal(
          psSym->psTab=psSym->psStd->psAli->psTab;
       }
    }
+   vdClpIdxKwl(psTab);
+   return(CLP_OK);
+}
+
+static int siClpSymKwl(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   TsSym*                        psTab)
+{
+   const TsIdx*                  psIdx=(psTab!=NULL)?psTab->psIdx:NULL;
+   TsSym*                        psSym;
+   int                           i,k;
+   for (psSym=psTab;psSym!=NULL;psSym=psSym->psNxt) {
+      psSym->psStd->siKwl=strlen(psSym->psStd->pcKyw);
+      if (psHdl->siMkl>0 && psSym->psStd->siKwl>psHdl->siMkl) { psSym->psStd->siKwl=psHdl->siMkl; }
+   }
+   if (psHdl->siMkl>0 && psIdx!=NULL) { // the longest common prefix with the sorted neighbours determines the required length
+      for (i=0;i+1<psIdx->siCnt;i++) {
+         const char* pcKy1=psIdx->asKyx[i].pcKey;
+         const char* pcKy2=psIdx->asKyx[i+1].pcKey;
+         TsStd*      psSt1=psIdx->asKyx[i].psSym->psStd;
+         TsStd*      psSt2=psIdx->asKyx[i+1].psSym->psStd;
+         for (k=0;pcKy1[k] && pcKy1[k]==pcKy2[k];k++) {}
+         if (pcKy1[k]==0 && pcKy2[k]==0) {
+            return CLPERR(psHdl,CLPERR_TAB,"Key word '%s.%s' is not unique",fpcPat(psHdl,siLev),psSt1->pcKyw);
+         }
+         if (psSt1->siKwl<=k) { psSt1->siKwl=k+1; }
+         if (psSt2->siKwl<=k) { psSt2->siKwl=k+1; }
+         if (pcKy1[k]==0) { psSt1->siKwl=k; } // prefix of the next keyword must be written completely
+      }
+   }
    return(CLP_OK);
 }
 
@@ -3557,28 +4857,50 @@ extern const TsClpArgument* psClpFindArgument(
    return(NULL);
 }
 
+static const TsKyx* psClpKyxFnd(
+   TsHdl*                        psHdl,
+   const char*                   pcKyw,
+   const TsIdx*                  psIdx,
+   const int                     siPos)
+{
+   const TsKyx*                  psFnd=NULL;
+   char                          acKey[CLPMAX_KYWSIZ];
+   U64                           uiPfx,uiMsk;
+   int                           l,lo;
+   if (psIdx==NULL) { return(NULL); }
+   l=siClpKyxKey(psHdl,pcKyw,acKey);
+   if (l<0) { return(NULL); }
+   uiPfx=ClpKyxPfx(acKey);
+   uiMsk=(l>=8)?~(U64)0:(l==0)?0:~(~(U64)0>>(8*l));
+   for (lo=siClpKyxLow(psIdx,acKey,uiPfx,l);lo<psIdx->siCnt && ((psIdx->asKyx[lo].uiPfx^uiPfx)&uiMsk)==0 && (l<=8 || strncmp(psIdx->asKyx[lo].pcKey+8,acKey+8,l-8)==0);lo++) {
+      const TsKyx* psKyx=psIdx->asKyx+lo;
+      if (l>=psKyx->siKwl) {
+         if (psFnd==NULL) {
+            psFnd=psKyx;
+         } else if (siPos<0) { // first in table order
+            if (psKyx->siPos<psFnd->siPos) { psFnd=psKyx; }
+         } else { // first backward from siPos, then forward behind siPos
+            if (psKyx->siPos<=siPos) {
+               if (psFnd->siPos>siPos || psKyx->siPos>psFnd->siPos) { psFnd=psKyx; }
+            } else if (psFnd->siPos>siPos && psKyx->siPos<psFnd->siPos) {
+               psFnd=psKyx;
+            }
+         }
+      }
+   }
+   return(psFnd);
+}
+
 static const TsSym* psClpFndSym(
    TsHdl*                        psHdl,
    const char*                   pcKyw,
    const TsSym*                  psTab)
 {
-   const TsSym*                  psHlp=NULL;
-   int                           i,j,k;
-   for (i=0,psHlp=psTab;psHlp!=NULL && psHlp->psStd!=NULL;psHlp=psHlp->psNxt,i++) {
-      if (!CLPISF_LNK(psHlp->psStd->uiFlg)) {
-         if (psHdl->isCas) {
-            for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-               if (pcKyw[j]!=psHlp->psStd->pcKyw[j]) { k++; }
-            }
-         } else {
-            for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-               if (toupper(pcKyw[j])!=toupper(psHlp->psStd->pcKyw[j])) { k++; }
-            }
-         }
-         if (k==0 && j>=psHlp->psStd->siKwl) {
-            TRACE(psHdl->pfPrs,"FIND-SYMBOL1(KYW=%s(%s))\n",pcKyw,psHlp->psStd->pcKyw);
-            return(psHlp);
-         }
+   if (psTab!=NULL) {
+      const TsKyx* psKyx=psClpKyxFnd(psHdl,pcKyw,psTab->psIdx,-1);
+      if (psKyx!=NULL) {
+         TRACE(psHdl->pfPrs,"FIND-SYMBOL1(KYW=%s(%s))\n",pcKyw,psKyx->psSym->psStd->pcKyw);
+         return(psKyx->psSym);
       }
    }
    return(NULL);
@@ -3589,44 +4911,11 @@ static const TsSym* psClpFndSym2(
    const char*                   pcKyw,
    const TsSym*                  psTab)
 {
-   const TsSym*                  psHlp=NULL;
-   if (psTab) {
-      int i;
-      for (i=0,psHlp=psTab;psHlp!=NULL && psHlp->psStd!=NULL;psHlp=psHlp->psBak,i++) {
-         if (!CLPISF_LNK(psHlp->psStd->uiFlg)) {
-            int j,k;
-            if (psHdl->isCas) {
-               for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-                  if (pcKyw[j]!=psHlp->psStd->pcKyw[j]) { k++; }
-               }
-            } else {
-               for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-                  if (toupper(pcKyw[j])!=toupper(psHlp->psStd->pcKyw[j])) { k++; }
-               }
-            }
-            if (k==0 && j>=psHlp->psStd->siKwl) {
-               TRACE(psHdl->pfPrs,"FIND-SYMBOL2a(KYW=%s(%s))\n",pcKyw,psHlp->psStd->pcKyw);
-               return(psHlp);
-            }
-         }
-      }
-      for (i=0,psHlp=psTab->psNxt;psHlp!=NULL && psHlp->psStd!=NULL;psHlp=psHlp->psNxt,i++) {
-         if (!CLPISF_LNK(psHlp->psStd->uiFlg)) {
-            int j,k;
-            if (psHdl->isCas) {
-               for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-                  if (pcKyw[j]!=psHlp->psStd->pcKyw[j]) { k++; }
-               }
-            } else {
-               for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-                  if (toupper(pcKyw[j])!=toupper(psHlp->psStd->pcKyw[j])) { k++; }
-               }
-            }
-            if (k==0 && j>=psHlp->psStd->siKwl) {
-               TRACE(psHdl->pfPrs,"FIND-SYMBOL2b(KYW=%s(%s))\n",pcKyw,psHlp->psStd->pcKyw);
-               return(psHlp);
-            }
-         }
+   if (psTab!=NULL) {
+      const TsKyx* psKyx=psClpKyxFnd(psHdl,pcKyw,psTab->psIdx,psTab->siPos);
+      if (psKyx!=NULL) {
+         TRACE(psHdl->pfPrs,"FIND-SYMBOL2%c(KYW=%s(%s))\n",(psKyx->siPos<=psTab->siPos)?'a':'b',pcKyw,psKyx->psSym->psStd->pcKyw);
+         return(psKyx->psSym);
       }
    }
    return(NULL);
@@ -3640,8 +4929,7 @@ static int siClpSymFnd(
    TsSym**                       ppArg,
    int*                          piElm)
 {
-   const TsSym*                  psHlp=NULL;
-   int                           i,j,k,e;
+   const TsKyx*                  psKyx;
    *ppArg=NULL;
    if (psTab==NULL) {
       CLPERR(psHdl,CLPERR_SYN,"Keyword '%s.%s' not valid",fpcPat(psHdl,siLev),pcKyw);
@@ -3653,29 +4941,12 @@ static int siClpSymFnd(
       CLPERRADD(psHdl,      1,"Try to find keyword '%s' in this table",pcKyw);
       return(CLPERR_INT);
    }
-   for (e=i=0,psHlp=psTab;psHlp!=NULL && psHlp->psStd!=NULL;psHlp=psHlp->psNxt,i++) {
-      if (!CLPISF_LNK(psHlp->psStd->uiFlg)) {
-         if (psHdl->isCas) {
-            for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-               if (pcKyw[j]!=psHlp->psStd->pcKyw[j]) { k++; }
-            }
-         } else {
-            for (k=j=0;k==0 && pcKyw[j]!=EOS && psHlp->psStd->pcKyw!=NULL;j++) {
-               if (toupper(pcKyw[j])!=toupper(psHlp->psStd->pcKyw[j])) { k++; }
-            }
-         }
-         if (k==0 && j>=psHlp->psStd->siKwl) {
-            if (piElm!=NULL) { (*piElm)=e; }
-            *ppArg=(TsSym*)psHlp;
-            TRACE(psHdl->pfPrs,"%s FIND-SYMBOL3(LEV=%d ELM=%d IND=%d KYW=%s(%s))\n",fpcPre(psHdl,siLev),siLev,e,i,pcKyw,psHlp->psStd->pcKyw);
-            return(i);
-         }
-         if (piElm!=NULL) {
-            if (CLPISF_ARG(psHlp->psStd->uiFlg) || CLPISF_CON(psHlp->psStd->uiFlg)) {
-               e++;
-            }
-         }
-      }
+   psKyx=psClpKyxFnd(psHdl,pcKyw,psTab->psIdx,-1);
+   if (psKyx!=NULL) {
+      if (piElm!=NULL) { (*piElm)=psKyx->siElm; }
+      *ppArg=psKyx->psSym;
+      TRACE(psHdl->pfPrs,"%s FIND-SYMBOL3(LEV=%d ELM=%d IND=%d KYW=%s(%s))\n",fpcPre(psHdl,siLev),siLev,(piElm!=NULL)?psKyx->siElm:0,psKyx->siPos,pcKyw,psKyx->psSym->psStd->pcKyw);
+      return(psKyx->siPos);
    }
    CLPERR(psHdl,CLPERR_SYN,"Parameter '%s.%s' not valid",fpcPat(psHdl,siLev),pcKyw);
    CLPERRADD(psHdl,0,"Please use one of the following parameters:%s","");
@@ -3735,172 +5006,960 @@ static void vdClpSymDel(
          if (!CLPISF_ALI(psHlp->psStd->uiFlg) && psHlp->psDep!=NULL) {
             vdClpSymDel(psHlp->psDep,piCnt,piSiz);
          }
-         if (psHlp->psHih!=NULL) { // not really required
-            psHlp->psHih->psDep=NULL;
-         }
-         if (psHlp->psNxt!=NULL) { // not really required
-            psHlp->psNxt->psBak=NULL;
-         }
-         if (!CLPISF_ALI(psHlp->psStd->uiFlg) && psHlp->psVar!=NULL) {
-            (*piSiz)+=sizeof(TsVar);
-            memset(psHlp->psVar,0,sizeof(TsVar));
-            free(psHlp->psVar);
-            psHlp->psVar=NULL;
-         }
          if (!CLPISF_ALI(psHlp->psStd->uiFlg) && psHlp->psFix!=NULL) {
-            if (psHlp->psFix->pcPro!=NULL) {
-               (*piSiz)+=strlen(psHlp->psFix->pcPro)+1;
-               free(psHlp->psFix->pcPro);
-            }
-            if (psHlp->psFix->pcSrc!=NULL) {
-               (*piSiz)+=strlen(psHlp->psFix->pcSrc)+1;
-               free(psHlp->psFix->pcSrc);
-            }
             (*piSiz)+=sizeof(TsFix);
-            memset(psHlp->psFix,0,sizeof(TsFix));
-            free(psHlp->psFix);
-            psHlp->psFix=NULL;
          }
          (*piSiz)+=sizeof(TsStd);
-         memset(psHlp->psStd,0,sizeof(TsStd));
-         free(psHlp->psStd);
-         psHlp->psStd=NULL;
       }
-      TsSym* psOld=psHlp;
-      psHlp=psHlp->psNxt;
       (*piSiz)+=sizeof(TsSym);
-      memset(psOld,0,sizeof(TsSym));
-      free(psOld);
       (*piCnt)++;
+      psHlp=psHlp->psNxt;
    }
 }
 
-/* Scanner ************************************************************/
-
-#define STRCHR '\''
-#define SPMCHR '\"'
-#define ALTCHR C_GRV
+static void* pvClpSymAlc(
+   TsHdl*                        psHdl,
+   const size_t                  szSiz)
+{
+   const size_t                  szAln=(szSiz+CLPINI_BLKALN-1)&~((size_t)CLPINI_BLKALN-1);
+   TsBlk*                        psBlk=psHdl->psTpl->psBlk;
+   if (psBlk==NULL || psBlk->szUsd+szAln>psBlk->szBlk) {
+      size_t szBlk=CLPINI_BLKSIZ;
+      if (CLPBLK_HDRSIZ+szAln>szBlk) { szBlk=CLPBLK_HDRSIZ+szAln; }
+      psBlk=(TsBlk*)calloc(1,szBlk);
+      if (psBlk==NULL) { return(NULL); }
+      psBlk->psNxt=psHdl->psTpl->psBlk;
+      psBlk->szBlk=szBlk;
+      psBlk->szUsd=CLPBLK_HDRSIZ;
+      psHdl->psTpl->psBlk=psBlk;
+   }
+   void* pvPtr=((char*)psBlk)+psBlk->szUsd;
+   psBlk->szUsd+=szAln;
+   return(pvPtr);
+}
 
-extern int siClpLexemes(
-   void*                         pvHdl,
-   FILE*                         pfOut)
+static void vdClpSymRel(
+   TsTpl*                        psTpl,
+   const char*                   pcFnc)
 {
-   if (pfOut!=NULL) {
-      TsHdl* psHdl=(TsHdl*)pvHdl;
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," COMMENT   '#' [:print:]* '#'                              (will be ignored)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCOMMENT  ';' [:print:]* 'nl'                             (will be ignored)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SEPARATOR [:space: | :cntr: | ',']*                  (abbreviated with SEP)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," OPERATOR '=' | '.' | '(' | ')' | '[' | ']' | (SGN, DOT, RBO, RBC, SBO, SBC)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"  '=>'| '+' | '-' | '*' | '/' | '{' | '}' (SAB, ADD, SUB, MUL, DIV, CBO,CBC)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," KEYWORD   ['-'['-']][:alpha:]+[:alnum: | '_']*          (always predefined)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SELECTION ['-'['-']][:alpha:]+[:alnum: | '_' | '-' | '/']*     (predefined)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," NUMBER    ([+|-]  [ :digit:]+)  |                       (decimal (default))\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0b[ :digit:]+)  |                                  (binary)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0o[ :digit:]+)  |                                   (octal)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0d[ :digit:]+)  |                                 (decimal)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0x[ :xdigit:]+) |                             (hexadecimal)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0t(yyyy/mm/tt.hh:mm:ss)) |  (relativ (+|-) or absolut time)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," FLOAT     ([+|-]  [ :digit:]+.[:digit:]+e|E[:digit:]+) | (decimal(default))\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," flt       ([+|-]0d[ :digit:]+.[:digit:]+e|E[:digit:]+)            (decimal)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," STRING         ''' [:print:]* ''' |          (default (if binary c else s))\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [s|S]''' [:print:]* ''' |                (null-terminated string)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [c|C]''' [:print:]* ''' |  (binary string in local character set)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [a|A]''' [:print:]* ''' |                (binary string in ASCII)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [e|E]''' [:print:]* ''' |               (binary string in EBCDIC)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [x|X]''' [:print:]* ''' |         (binary string in hex notation)\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [f|F]''' [:print:]* ''' | (read string from file (for passwords))\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Strings can contain two '' to represent one '                    \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Strings can also be enclosed in \" or %c instead of '              \n",ALTCHR);
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Strings can directly start behind a '=' without enclosing ('%c\")  \n",ALTCHR);
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"              In this case the string ends at the next separator or operator\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"              and keywords are preferred. To use keywords, separators or    \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"              operators in strings, enclosing quotes are required.          \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"                                                                            \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," The predefined constant keyword below can be used in a value expressions   \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," NOW       NUMBER - current time in seconds since 1970 (+0t0000)            \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," MINUTE    NUMBER - minute in seconds (60)                                  \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," HOUR      NUMBER - hour in seconds   (60*60)                               \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," DAY       NUMBER - day in seconds    (24*60*60)                            \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," YEAR      NUMBER - year in seconds   (365*24*60*60)                        \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," KiB       NUMBER - kilobyte          (1024)                                \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," MiB       NUMBER - megabyte          (1024*1024)                           \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GiB       NUMBER - gigabyte          (1024*1024*1024)                      \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," TiB       NUMBER - terrabyte         (1024*1024*1024*1024)                 \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," RNDn      NUMBER - simple random number with n * 8 bit in length (1,2,4,8) \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," PI        FLOAT  - PI (3.14159265359)                                      \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCSTAMP   STRING - current local stamp in format:           YYYYMMDD.HHMMSS\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCDATE    STRING - current local date in format:            YYYYMMDD       \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCYEAR    STRING - current local year in format:            YYYY           \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCYEAR2   STRING - current local year in format:            YY             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCMONTH   STRING - current local month in format:           MM             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCDAY     STRING - current local day in format:             DD             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCTIME    STRING - current local time in format:            HHMMSS         \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCHOUR    STRING - current local hour in format:            HH             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCMINUTE  STRING - current local minute in format:          MM             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCSECOND  STRING - current local second in format:          SS             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCOFFSET  STRING - difference to Greenwich mean time:    +/-HH             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCOFFABS  STRING - difference to GMT (absolute):             HH             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMSTAMP   STRING - current Greenwich mean stamp in format:  YYYYMMDD.HHMMSS\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMDATE    STRING - current Greenwich mean date in format:   YYYYMMDD       \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMYEAR    STRING - current Greenwich mean year in format:   YYYY           \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMYEAR2   STRING - current Greenwich mean year in format:   YY             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMMONTH   STRING - current Greenwich mean month in format:  MM             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMDAY     STRING - current Greenwich mean day in format:    DD             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMTIME    STRING - current Greenwich mean time in format:   HHMMSS         \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMHOUR    STRING - current Greenwich mean hour in format:   HH             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMMINUTE  STRING - current Greenwich mean minute in format: MM             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMSECOND  STRING - current Greenwich mean second in format: SS             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMOFFSET  STRING - difference to local time:             +/-HH             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMOFFABS  STRING - difference to local time (absolute):     HH             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SnRND10   STRING - decimal random number of length n (1 to 8)              \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SnRND16   STRING - hexadecimal random number of length n (1 to 8)          \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"                                                                            \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SUPPLEMENT     '\"' [:print:]* '\"' |   (null-terminated string (properties))\n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Supplements can contain two \"\" to represent one \"                \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Supplements can also be enclosed in ' or %c instead of \"          \n",ALTCHR);
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Supplements can also be enclosed in ' or %c instead of \"          \n",ALTCHR);
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," ENVIRONMENT VARIABLES '<'varnam'>' will replaced by the corresponding value  \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," Escape sequences for critical punctuation characters on EBCDIC systems     \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '!' = '&EXC;'   - Exclamation mark                                      \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '$' = '&DLR;'   - Dollar sign                                           \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '#' = '&HSH;'   - Hashtag (number sign)                                 \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '@' = '&ATS;'   - At sign                                               \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '[' = '&SBO;'   - Square bracket open                                   \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '\\' = '&BSL;'   - Backslash                                             \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    ']' = '&SBC;'   - Square bracket close                                  \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '^' = '&CRT;'   - Caret (circumflex)                                    \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '`' = '&GRV;'   - Grave accent                                          \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '{' = '&CBO;'   - Curly bracket open                                    \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '|' = '&VBR;'   - Vertical bar                                          \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '}' = '&CBC;'   - Curly bracket close                                   \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '~' = '&TLD;'   - Tilde                                                 \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," Define CCSIDs for certain areas in CLP strings on EBCDIC systems (0-reset) \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '&' [:digit:]+ ';  (...\"&1047;get.file='&0;%%s&1047;'\",f)                \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," Escape sequences for hexadecimal byte values                               \n");
-      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '&' ['X''x'] :xdigit: :xdigit: ';' (\"&xF5;\")                            \n");
+   uint64_t                      uiCnt=0;
+   uint64_t                      uiSiz=0;
+   uint64_t                      uiUsd=0;
+   uint64_t                      uiImg=0;
+   while (psTpl->psBlk!=NULL) {
+      TsBlk* psBlk=psTpl->psBlk;
+      psTpl->psBlk=psBlk->psNxt;
+      uiCnt++;
+      uiSiz+=psBlk->szBlk;
+      uiUsd+=psBlk->szUsd;
+      memset(psBlk,0,psBlk->szBlk);
+      free(psBlk);
+   }
+   if (psTpl->pvImg!=NULL) {
+      uiImg=psTpl->szImg;
+      vdClpImgUnm((char*)psTpl->pvImg,psTpl->szImg);
+      psTpl->pvImg=NULL;
+      psTpl->szImg=0;
+   }
+   if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
+      char acTs[24];
+      fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Arena(Blocks(%"PRIu64"),Size(%"PRIu64"),Used(%"PRIu64")),Image(%"PRIu64")) %s\n",cstime(0,acTs),uiCnt,uiSiz,uiUsd,uiImg,pcFnc);
    }
-   return(CLP_OK);
 }
 
-static inline int isPrintF(const TsSym* p) { return (p != NULL) ? (CLPISF_PWD(p->psStd->uiFlg) == FALSE) : TRUE; }
-static inline char* isPrnLex(const TsSym* p, char* l) { return (isPrintF(p)) ? l : "***SECRET***"; }
-static inline int isPrintF2(const TsSym* p) { return (CLPISF_PWD(p->psStd->uiFlg)==FALSE); }
-static inline const char* isPrnLex2(const TsSym* p, const char* l) { return (isPrintF2(p)) ? l : "***SECRET***"; }
-static inline int isStringChr(int c) { return (c == STRCHR || c == SPMCHR || c == ALTCHR); }
-static inline int isSeparation(int c) { return (isspace(c) || iscntrl(c) || c == ','); }
-static inline int isReqStrOpr1(int c) { return (c == '=' || c == '+' || c == ')' || c == C_SBC || c == C_CBC); }// required string cannot start with this characters
-static inline int isReqStrOpr2(int c) { return (c == ';' || c == C_HSH); }                                      // required string must end at this
-static inline int isReqStrOpr3(int c) { return (isReqStrOpr1(c) || c == '(' || c == '.' || c == C_SBO || c == C_CBO || isStringChr(c)); }// required string must end at key word if one of this follows
+/* Shared symbol table templates **************************************/
 
-#define LEX_REALLOC do {\
-   if (pcLex>=(pcEnd-4)) {\
-      intptr_t l=pcLex-(*ppLex);\
-      intptr_t h=pcHlp-(*ppLex);\
-      intptr_t z=(pcZro!=NULL)?pcZro-(*ppLex):0;\
-      size_t s=(*pzLex)+CLPINI_LEXSIZ;\
-      char*  b=(char*)realloc_nowarn(*ppLex,s);\
-      if (b==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Re-allocation of buffer in size %d to store the lexeme failed",(int)s); }\
-      (*pzLex)=s;\
+static int siClpTplRec(
+   const TsClpArgument*          psTab,
+   const TsClpArgument**         ppStk,
+   const int                     siDep)
+{
+   int                           i;
+   if (siDep>=CLPMAX_HDEPTH) return(TRUE);
+   for (i=0;i<siDep;i++) {
+      if (ppStk[i]==psTab) return(TRUE);
+   }
+   ppStk[siDep]=psTab;
+   for (i=0;psTab[i].siTyp;i++) {
+      if (psTab[i].psTab!=NULL && siClpTplRec(psTab[i].psTab,ppStk,siDep+1)) return(TRUE);
+   }
+   return(FALSE);
+}
+
+static int siClpTplGet(
+   TsHdl*                        psHdl,
+   const TsClpArgument*          psTab)
+{
+   TsTpl*                        psTpl=NULL;
+   char*                         pcKey=NULL;
+#ifdef __UNIX__
+   if (CHECK_ENVAR_ON("CLP_SYMTAB_SHARED") && !cle_thdalc()) { // a thread allocator can release the memory before the last handle
+      const TsClpArgument*       apStk[CLPMAX_HDEPTH];
+      if (!siClpTplRec(psTab,apStk,0)) {
+         size_t                  szKey=strlen(psHdl->pcOwn)+strlen(psHdl->pcPgm)+strlen(psHdl->pcCmd)+64;
+         pcKey=(char*)malloc(szKey);
+         if (pcKey==NULL) {
+            return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol table key failed");
+         }
+         snprintf(pcKey,szKey,"%d.%d.%d.%s.%s.%s",psHdl->isCas,psHdl->siMkl,CHECK_ENVAR_OFF("CLEP_NO_SECRETS"),psHdl->pcOwn,psHdl->pcPgm,psHdl->pcCmd);
+         // The lazy build of sub tables changes the template while parsing, which is not possible for a
+         // template shared between threads. A shared template is built fully once per process instead.
+         psHdl->isFul=TRUE;
+         CLPTPL_LOCK();
+         for (psTpl=psClpTplLst;psTpl!=NULL;psTpl=psTpl->psNxt) {
+            if (psTpl->psArg==psTab && strcmp(psTpl->pcKey,pcKey)==0) break;
+         }
+         if (psTpl!=NULL) psTpl->siRef++;
+         CLPTPL_UNLOCK();
+         if (psTpl!=NULL) {
+            free(pcKey);
+            psHdl->psTpl=psTpl;
+            psHdl->psTab=psTpl->psTab;
+            return(TRUE);
+         }
+      }
+   }
+#endif
+   psTpl=(TsTpl*)calloc(1,sizeof(TsTpl));
+   if (psTpl==NULL) {
+      SAFE_FREE(pcKey);
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol table template failed");
+   }
+   psTpl->psArg=psTab;
+   psTpl->pcKey=pcKey;
+   psTpl->siRef=1;
+   psHdl->psTpl=psTpl;
+   return(FALSE);
+}
+
+static void vdClpTplReg(
+   TsHdl*                        psHdl)
+{
+#ifdef __UNIX__
+   TsTpl*                        psTpl=psHdl->psTpl;
+   TsTpl*                        psHlp;
+   if (psTpl->pcKey!=NULL) {
+      CLPTPL_LOCK();
+      for (psHlp=psClpTplLst;psHlp!=NULL;psHlp=psHlp->psNxt) {
+         if (psHlp->psArg==psTpl->psArg && strcmp(psHlp->pcKey,psTpl->pcKey)==0) break;
+      }
+      if (psHlp==NULL) {
+         psTpl->isShr=TRUE;
+         psTpl->psNxt=psClpTplLst;
+         psClpTplLst=psTpl;
+      }
+      CLPTPL_UNLOCK();
+   }
+#endif
+}
+
+static void vdClpTplRel(
+   TsHdl*                        psHdl,
+   const char*                   pcFnc)
+{
+   TsTpl*                        psTpl=psHdl->psTpl;
+   uint64_t                      uiCnt=0;
+   uint64_t                      uiSiz=0;
+   int                           i;
+   if (psTpl==NULL) return;
+   vdClpVarDel(psHdl);
+   psHdl->psTpl=NULL;
+   psHdl->psTab=NULL;
+#ifdef __UNIX__
+   if (psTpl->isShr) {
+      TsTpl**                    ppHlp;
+      CLPTPL_LOCK();
+      psTpl->siRef--;
+      if (psTpl->siRef>0) {
+         CLPTPL_UNLOCK();
+         return;
+      }
+      for (ppHlp=&psClpTplLst;*ppHlp!=NULL;ppHlp=&(*ppHlp)->psNxt) {
+         if (*ppHlp==psTpl) {
+            *ppHlp=psTpl->psNxt;
+            break;
+         }
+      }
+      CLPTPL_UNLOCK();
+   }
+#endif
+   vdClpSymDel(psTpl->psTab,&uiCnt,&uiSiz);
+   for (i=0;i<psTpl->siVar;i++) {
+      if (psTpl->psPro[i].pcPro!=NULL) {
+         uiSiz+=strlen(psTpl->psPro[i].pcPro)+1;
+         free(psTpl->psPro[i].pcPro);
+      }
+      if (psTpl->psPro[i].pcSrc!=NULL) {
+         uiSiz+=strlen(psTpl->psPro[i].pcSrc)+1;
+         free(psTpl->psPro[i].pcSrc);
+      }
+   }
+   uiSiz+=psTpl->siVar*(sizeof(TsVar)+sizeof(TsPro));
+   if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
+      char acTs[24];
+      fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Amount(%"PRIu64"),Size(%"PRIu64")) %s\n",cstime(0,acTs),uiCnt,uiSiz,pcFnc);
+   }
+   SAFE_FREE(psTpl->psVar);
+   SAFE_FREE(psTpl->psPro);
+   vdClpSymRel(psTpl,pcFnc);
+   SAFE_FREE(psTpl->pcKey);
+   free(psTpl);
+}
+
+/* Symbol table image *************************************************/
+
+static inline U64 ClpImgFnv(U64 uiHsh, const void* pvDat, const size_t szDat)
+{
+   const unsigned char* p=(const unsigned char*)pvDat;
+   for (size_t i=0;i<szDat;i++) {
+      uiHsh^=p[i]; uiHsh*=0x100000001b3LLU;
+   }
+   return(uiHsh);
+}
+
+static inline U64 ClpImgStr(U64 uiHsh, const char* pcStr)
+{
+   if (pcStr==NULL) {
+      return(ClpImgFnv(uiHsh,"\xFF",1));
+   }
+   return(ClpImgFnv(uiHsh,pcStr,strlen(pcStr)+1));
+}
+
+static inline U64 ClpImgInt(U64 uiHsh, const I64 siVal)
+{
+   return(ClpImgFnv(uiHsh,&siVal,sizeof(siVal)));
+}
+
+static const void* pvClpImgFld(
+   const TsClpArgument*          psEnt,
+   const U32                     uiFld)
+{
+   switch (uiFld) {
+   case 0: return(psEnt);
+   case 1: return(psEnt->pcKyw);
+   case 2: return(psEnt->pcAli);
+   case 3: return(psEnt->pcDft);
+   case 4: return(psEnt->pcMan);
+   case 5: return(psEnt->pcHlp);
+   case 6: return(&psEnt->siVal);
+   case 7: return(&psEnt->flVal);
+   case 8: return(psEnt->pcVal);
+   case 9: return(psEnt->pcTyp);
+   default:return(NULL);
+   }
+}
+
+static int siClpImgTab(
+   TsImc*                        psImc,
+   const TsClpArgument*          psTab)
+{
+   int                           i,n,siTab;
+   for (i=0;i<psImc->siTab;i++) {
+      if (psImc->ppTab[i]==psTab) { return(i); }
+   }
+   if (psImc->siTab>=psImc->szTab) {
+      int szTab=(psImc->szTab)?psImc->szTab*2:64;
+      const TsClpArgument** ppTab=(const TsClpArgument**)realloc((void*)psImc->ppTab,szTab*sizeof(*ppTab));
+      if (ppTab==NULL) { return(-1); }
+      psImc->ppTab=ppTab;
+      psImc->szTab=szTab;
+   }
+   siTab=psImc->siTab++;
+   psImc->ppTab[siTab]=psTab;
+   for (n=0;psTab[n].siTyp;n++);
+   if (psImc->siEnt+n+1>psImc->szEnt) {
+      int szEnt=(psImc->szEnt)?psImc->szEnt*2:256;
+      if (szEnt<psImc->siEnt+n+1) { szEnt=psImc->siEnt+n+1; }
+      const TsClpArgument** ppEnt=(const TsClpArgument**)realloc((void*)psImc->ppEnt,szEnt*sizeof(*ppEnt));
+      if (ppEnt==NULL) { return(-1); }
+      psImc->ppEnt=ppEnt;
+      psImc->szEnt=szEnt;
+   }
+   for (i=0;i<=n;i++) {
+      psImc->ppEnt[psImc->siEnt++]=psTab+i;
+   }
+   psImc->uiHsh=ClpImgInt(psImc->uiHsh,n);
+   for (i=0;i<n;i++) {
+      const TsClpArgument* psEnt=psTab+i;
+      U64                  h=psImc->uiHsh;
+      h=ClpImgInt(h,psEnt->siTyp);
+      h=ClpImgStr(h,psEnt->pcKyw);
+      h=ClpImgStr(h,psEnt->pcAli);
+      h=ClpImgInt(h,psEnt->siMin);
+      h=ClpImgInt(h,psEnt->siMax);
+      h=ClpImgInt(h,psEnt->siSiz);
+      h=ClpImgInt(h,psEnt->siOfs);
+      h=ClpImgInt(h,psEnt->siOid);
+      h=ClpImgInt(h,psEnt->uiFlg);
+      h=ClpImgStr(h,psEnt->pcTyp);
+      h=ClpImgInt(h,(psEnt->pcDft!=NULL)|(psEnt->pcMan!=NULL)<<1|(psEnt->pcHlp!=NULL)<<2|(psEnt->pcVal!=NULL)<<3);
+      h=ClpImgInt(h,(psEnt->pcVal!=NULL && !CLPISF_BIN(psEnt->uiFlg))?(I64)strlen((const char*)psEnt->pcVal):-1);
+      psImc->uiHsh=h;
+      if (psEnt->psTab!=NULL) {
+         int k=siClpImgTab(psImc,psEnt->psTab);
+         if (k<0) { return(k); }
+         psImc->uiHsh=ClpImgInt(psImc->uiHsh,k);
+      } else {
+         psImc->uiHsh=ClpImgInt(psImc->uiHsh,-1);
+      }
+   }
+   return(siTab);
+}
+
+static void vdClpImgDel(
+   TsImc*                        psImc)
+{
+   SAFE_FREE(psImc->ppTab);
+   SAFE_FREE(psImc->ppEnt);
+   psImc->siTab=psImc->szTab=0;
+   psImc->siEnt=psImc->szEnt=0;
+}
+
+static char* pcClpImgFil(
+   TsHdl*                        psHdl,
+   const TsClpArgument*          psTab,
+   TsImc*                        psImc)
+{
+   const char*                   pcDir=GETENV("CLP_SYMTAB_IMAGE");
+   char*                         pcFil;
+   size_t                        szFil,i;
+   U64                           h=0xcbf29ce484222325LLU;
+   memset(psImc,0,sizeof(TsImc));
+   if (pcDir==NULL || *pcDir==EOS) {
+      return(NULL);
+   }
+   h=ClpImgStr(h,CLP_VSN_STR" "__DATE__" "__TIME__);
+   h=ClpImgInt(h,sizeof(void*));
+   h=ClpImgInt(h,sizeof(TsSym));
+   h=ClpImgInt(h,sizeof(TsStd));
+   h=ClpImgInt(h,sizeof(TsFix));
+   h=ClpImgInt(h,sizeof(TsVar));
+   h=ClpImgInt(h,sizeof(TsKyx));
+   h=ClpImgInt(h,sizeof(TsBlk));
+   h=ClpImgInt(h,psHdl->isCas);
+   h=ClpImgInt(h,psHdl->siMkl);
+   h=ClpImgInt(h,psHdl->isFul);
+   h=ClpImgInt(h,CHECK_ENVAR_OFF("CLEP_NO_SECRETS"));
+   psImc->uiHsh=h;
+   if (siClpImgTab(psImc,psTab)<0) {
+      vdClpImgDel(psImc);
+      return(NULL);
+   }
+   szFil=strlen(pcDir)+strlen(psHdl->pcOwn)+strlen(psHdl->pcPgm)+strlen(psHdl->pcCmd)+32;
+   pcFil=(char*)malloc(szFil);
+   if (pcFil==NULL) {
+      vdClpImgDel(psImc);
+      return(NULL);
+   }
+   // the hash of the tables and settings is part of the name, so handles with other settings don't overwrite the image
+   snprintf(pcFil,szFil,"%s/%s.%s.%s.%016"PRIx64".clpimg",pcDir,psHdl->pcOwn,psHdl->pcPgm,psHdl->pcCmd,(uint64_t)psImc->uiHsh);
+   for (i=strlen(pcDir)+1;pcFil[i];i++) {
+      if (!isalnum(pcFil[i]) && pcFil[i]!='.') { pcFil[i]='_'; }
+   }
+   return(pcFil);
+}
+
+static int siClpImgEnv(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   TsSym*                        psTab)
+{
+   TsSym*                        psSym;
+   int                           siErr;
+   for (psSym=psTab;psSym!=NULL;psSym=psSym->psNxt) {
+      if (!CLPISF_ALI(psSym->psStd->uiFlg)) {
+         if (psSym->siVar<0 || psSym->siVar>=psHdl->psTpl->siVar) {
+            return CLPERR(psHdl,CLPERR_INT,"Variable slot (%d) of symbol '%s' in image not valid",psSym->siVar,psSym->psStd->pcKyw);
+         }
+         siErr=siClpSymEnv(psHdl,fpcPat(psHdl,siLev),psSym->psArg,INIPRO(psHdl,psSym));
+         if (siErr<0) { return(siErr); }
+         if (CLPISF_CON(psSym->psStd->uiFlg)) {
+            vdClpSymCon(psHdl,psSym);
+         }
+         if (psSym->psDep!=NULL) {
+            psHdl->apPat[siLev]=psSym;
+            siErr=siClpImgEnv(psHdl,siLev+1,psSym->psDep);
+            if (siErr<0) { return(siErr); }
+         }
+      }
+   }
+   return(CLP_OK);
+}
+
+static void vdClpImgUnm(
+   char*                         pcImg,
+   const size_t                  szImg)
+{
+#ifdef __UNIX__
+   munmap(pcImg,szImg);
+#else
+   free(pcImg);
+#endif
+}
+
+static int siClpImgLod(
+   TsHdl*                        psHdl,
+   const TsImc*                  psImc,
+   const char*                   pcFil)
+{
+   char*                         pcImg=NULL;
+   size_t                        szImg=0;
+   const TsImg*                  psImg;
+   const TsRel*                  psRel;
+   char*                         pcDat;
+   U64                           i;
+   int                           siErr;
+#ifdef __UNIX__
+   struct stat                   stSta;
+   int                           siFil=open(pcFil,O_RDONLY);
+   if (siFil<0) {
+      return(FALSE);
+   }
+   if (fstat(siFil,&stSta)!=0 || stSta.st_size<(off_t)CLPIMG_HDRSIZ) {
+      close(siFil);
+      return(FALSE);
+   }
+   szImg=(size_t)stSta.st_size;
+   pcImg=(char*)mmap(NULL,szImg,PROT_READ|PROT_WRITE,MAP_PRIVATE,siFil,0);
+   close(siFil);
+   if (pcImg==(char*)MAP_FAILED) {
+      return(FALSE);
+   }
+#else
+   long                          siSiz;
+   FILE*                         pfFil=fopen(pcFil,"rb");
+   if (pfFil==NULL) {
+      return(FALSE);
+   }
+   if (fseek(pfFil,0,SEEK_END)!=0 || (siSiz=ftell(pfFil))<(long)CLPIMG_HDRSIZ || fseek(pfFil,0,SEEK_SET)!=0) {
+      fclose(pfFil);
+      return(FALSE);
+   }
+   szImg=(size_t)siSiz;
+   pcImg=(char*)malloc(szImg);
+   if (pcImg==NULL || fread(pcImg,1,szImg,pfFil)!=szImg) {
+      SAFE_FREE(pcImg);
+      fclose(pfFil);
+      return(FALSE);
+   }
+   fclose(pfFil);
+#endif
+   psImg=(const TsImg*)pcImg;
+   if (memcmp(psImg->acMag,CLPIMG_MAGIC,sizeof(psImg->acMag))!=0 || psImg->uiHsh!=psImc->uiHsh ||
+       psImg->siVar>psImg->siSym || psImg->szDat%CLPINI_BLKALN || psImg->uiTab>=psImg->szDat || psImg->szDat>szImg-CLPIMG_HDRSIZ ||
+       (szImg-CLPIMG_HDRSIZ-psImg->szDat)%sizeof(TsRel) || psImg->siRel!=(szImg-CLPIMG_HDRSIZ-psImg->szDat)/sizeof(TsRel)) {
+      vdClpImgUnm(pcImg,szImg);
+      return(FALSE);
+   }
+   pcDat=pcImg+CLPIMG_HDRSIZ;
+   psRel=(const TsRel*)(pcDat+psImg->szDat);
+   for (i=0;i<psImg->siRel;i++) {
+      const void* pvPtr=NULL;
+      if (psRel[i].uiOfs%sizeof(void*) || psRel[i].uiOfs>psImg->szDat-sizeof(void*)) {
+         break;
+      }
+      switch (psRel[i].uiKnd) {
+      case CLPIMG_RELINT:
+         if (psRel[i].uiVal<psImg->szDat) { pvPtr=pcDat+psRel[i].uiVal; }
+         break;
+      case CLPIMG_RELARG:
+         if (psRel[i].uiVal<(U64)psImc->siEnt) { pvPtr=pvClpImgFld(psImc->ppEnt[psRel[i].uiVal],psRel[i].uiFld); }
+         break;
+      }
+      if (pvPtr==NULL) {
+         break;
+      }
+      memcpy(pcDat+psRel[i].uiOfs,&pvPtr,sizeof(pvPtr));
+   }
+   if (i<psImg->siRel) {
+      vdClpImgUnm(pcImg,szImg);
+      return(FALSE);
+   }
+   psHdl->psTpl->pvImg=pcImg;
+   psHdl->psTpl->szImg=szImg;
+   psHdl->psTpl->psTab=psHdl->psTab=(TsSym*)(pcDat+psImg->uiTab);
+   psHdl->psTpl->siSym=(long)psImg->siSym;
+   while (psHdl->psTpl->siVar<(int)psImg->siVar) {
+      if (siClpSymVar(psHdl)<0) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory for symbol variables failed");
+      }
+   }
+   siErr=siClpImgEnv(psHdl,0,psHdl->psTab);
+   if (siErr<0) {
+      return(siErr);
+   }
+   if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
+      char acTs[24];
+      fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Image(Loaded(%s),Size(%"PRIu64"),Relocations(%"PRIu64")))\n",cstime(0,acTs),pcFil,(U64)szImg,psImg->siRel);
+   }
+   return(TRUE);
+}
+
+static int siClpImgOfs(
+   const TsIms*                  psIms,
+   const void*                   pvPtr,
+   U64*                          piOfs)
+{
+   for (int i=0;i<psIms->siBlk;i++) {
+      const char* pcBlk=(const char*)psIms->ppBlk[i];
+      if ((uintptr_t)pvPtr>=(uintptr_t)pcBlk && (uintptr_t)pvPtr<(uintptr_t)(pcBlk+psIms->ppBlk[i]->szUsd)) {
+         *piOfs=psIms->piOfs[i]+(U64)((const char*)pvPtr-pcBlk);
+         return(TRUE);
+      }
+   }
+   return(FALSE);
+}
+
+static int siClpImgPtr(
+   TsIms*                        psIms,
+   const void*                   pvLoc,
+   const void*                   pvPtr)
+{
+   U64                           uiOfs,uiVal;
+   TsRel*                        psRel;
+   if (!siClpImgOfs(psIms,pvLoc,&uiOfs)) {
+      return(-1);
+   }
+   memset(psIms->pcDat+uiOfs,0,sizeof(void*));
+   if (pvPtr==NULL) {
+      return(0);
+   }
+   if (psIms->siRel>=psIms->szRel) {
+      U64 szRel=(psIms->szRel)?psIms->szRel*2:1024;
+      psRel=(TsRel*)realloc(psIms->psRel,szRel*sizeof(TsRel));
+      if (psRel==NULL) { return(-1); }
+      psIms->psRel=psRel;
+      psIms->szRel=szRel;
+   }
+   psRel=psIms->psRel+psIms->siRel;
+   memset(psRel,0,sizeof(TsRel));
+   psRel->uiOfs=uiOfs;
+   if (siClpImgOfs(psIms,pvPtr,&uiVal)) {
+      psRel->uiKnd=CLPIMG_RELINT;
+      psRel->uiVal=uiVal;
+   } else {
+      int l=0,h=psIms->siMap;
+      while (l<h) {
+         int m=(l+h)/2;
+         if ((uintptr_t)psIms->psMap[m].pvPtr<(uintptr_t)pvPtr) { l=m+1; } else { h=m; }
+      }
+      if (l>=psIms->siMap || psIms->psMap[l].pvPtr!=pvPtr) {
+         return(-1);
+      }
+      psRel->uiKnd=CLPIMG_RELARG;
+      psRel->uiVal=psIms->psMap[l].uiOrd;
+      psRel->uiFld=psIms->psMap[l].uiFld;
+   }
+   psIms->siRel++;
+   return(0);
+}
+
+#define IMGPTR(f) if (siClpImgPtr(psIms,&(f),(f))<0) { return(-1); }
+
+static int siClpImgSym(
+   TsIms*                        psIms,
+   TsSym*                        psTab)
+{
+   TsSym*                        psSym;
+   for (psSym=psTab;psSym!=NULL;psSym=psSym->psNxt) {
+      if (psSym->psBak==NULL && psSym->psIdx!=NULL) {
+         TsIdx* psIdx=(TsIdx*)psSym->psIdx;
+         for (int i=0;i<psIdx->siCnt;i++) {
+            IMGPTR(psIdx->asKyx[i].pcKey);
+            IMGPTR(psIdx->asKyx[i].psSym);
+         }
+      }
+      IMGPTR(psSym->psArg);
+      IMGPTR(psSym->psTab);
+      IMGPTR(psSym->psNxt);
+      IMGPTR(psSym->psBak);
+      IMGPTR(psSym->psDep);
+      IMGPTR(psSym->psHih);
+      IMGPTR(psSym->psStd);
+      IMGPTR(psSym->psFix);
+      IMGPTR(psSym->psIdx);
+      IMGPTR(psSym->psStd->pcKyw);
+      IMGPTR(psSym->psStd->psAli);
+      if (!CLPISF_ALI(psSym->psStd->uiFlg)) {
+         TsFix* psFix=psSym->psFix;
+         IMGPTR(psFix->pcMan);
+         IMGPTR(psFix->pcHlp);
+         IMGPTR(psFix->psLnk);
+         IMGPTR(psFix->psCnt);
+         IMGPTR(psFix->psOid);
+         IMGPTR(psFix->psInd);
+         IMGPTR(psFix->psEln);
+         IMGPTR(psFix->psSln);
+         IMGPTR(psFix->psTln);
+         if (psSym->psDep!=NULL) {
+            if (siClpImgSym(psIms,psSym->psDep)<0) { return(-1); }
+         }
+      }
+   }
+   return(0);
+}
+
+#undef IMGPTR
+
+static int siClpImgCmp(
+   const void*                   pvMp1,
+   const void*                   pvMp2)
+{
+   const TsMap*                  psMp1=(const TsMap*)pvMp1;
+   const TsMap*                  psMp2=(const TsMap*)pvMp2;
+   if ((uintptr_t)psMp1->pvPtr!=(uintptr_t)psMp2->pvPtr) {
+      return(((uintptr_t)psMp1->pvPtr<(uintptr_t)psMp2->pvPtr)?-1:1);
+   }
+   if (psMp1->uiOrd!=psMp2->uiOrd) {
+      return((psMp1->uiOrd<psMp2->uiOrd)?-1:1);
+   }
+   return((psMp1->uiFld<psMp2->uiFld)?-1:(psMp1->uiFld>psMp2->uiFld));
+}
+
+static void vdClpImgWrt(
+   const TsIms*                  psIms,
+   const TsImg*                  psImg,
+   const char*                   pcFil)
+{
+   char                          acHdr[CLPIMG_HDRSIZ];
+   char*                         pcTmp;
+   FILE*                         pfTmp;
+   int                           isOk;
+
+   memset(acHdr,0,sizeof(acHdr));
+   memcpy(acHdr,psImg,sizeof(TsImg));
+   pcTmp=(char*)malloc(strlen(pcFil)+32);
+   if (pcTmp==NULL) {
+      return;
+   }
+#ifdef __UNIX__
+   sprintf(pcTmp,"%s.%d.tmp",pcFil,(int)getpid());
+#else
+   strcpy(pcTmp,pcFil);
+#endif
+   pfTmp=fopen(pcTmp,"wb");
+   if (pfTmp==NULL) {
+      free(pcTmp);
+      return;
+   }
+   isOk=fwrite(acHdr,1,sizeof(acHdr),pfTmp)==sizeof(acHdr) &&
+        fwrite(psIms->pcDat,1,psIms->szDat,pfTmp)==psIms->szDat &&
+        fwrite(psIms->psRel,sizeof(TsRel),psIms->siRel,pfTmp)==psIms->siRel;
+   if (fclose(pfTmp)!=0) {
+      isOk=FALSE;
+   }
+   if (isOk && strcmp(pcTmp,pcFil)!=0 && rename(pcTmp,pcFil)!=0) {
+      isOk=FALSE;
+   }
+   if (!isOk) {
+      remove(pcTmp);
+   } else if (CHECK_ENVAR_ON("CLP_SYMTAB_STATISTICS")) {
+      char acTs[24];
+      fprintf(stderr,"%s CLP_SYMTAB_STATISTICS(Image(Written(%s),Size(%"PRIu64"),Relocations(%"PRIu64")))\n",cstime(0,acTs),pcFil,
+              (U64)(sizeof(acHdr)+psIms->szDat+psIms->siRel*sizeof(TsRel)),psIms->siRel);
+   }
+   free(pcTmp);
+}
+
+static void vdClpImgSav(
+   TsHdl*                        psHdl,
+   const TsImc*                  psImc,
+   const char*                   pcFil)
+{
+   TsIms                         stIms;
+   TsImg                         stImg;
+   TsBlk*                        psBlk;
+   int                           i;
+   U32                           f;
+
+   memset(&stIms,0,sizeof(stIms));
+   memset(&stImg,0,sizeof(stImg));
+   stIms.psImc=psImc;
+   for (psBlk=psHdl->psTpl->psBlk;psBlk!=NULL;psBlk=psBlk->psNxt) {
+      stIms.siBlk++;
+   }
+   stIms.ppBlk=(TsBlk**)calloc(stIms.siBlk+1,sizeof(TsBlk*));
+   stIms.piOfs=(U64*)calloc(stIms.siBlk+1,sizeof(U64));
+   stIms.psMap=(TsMap*)calloc((size_t)psImc->siEnt*CLPIMG_FLDCNT+1,sizeof(TsMap));
+   if (stIms.ppBlk!=NULL && stIms.piOfs!=NULL && stIms.psMap!=NULL) {
+      for (i=0,psBlk=psHdl->psTpl->psBlk;psBlk!=NULL;psBlk=psBlk->psNxt,i++) {
+         stIms.ppBlk[i]=psBlk;
+         stIms.piOfs[i]=stIms.szDat;
+         stIms.szDat+=psBlk->szUsd;
+      }
+      stIms.pcDat=(char*)calloc(1,stIms.szDat+1);
+   }
+   if (stIms.pcDat!=NULL) {
+      for (i=0;i<stIms.siBlk;i++) {
+         memcpy(stIms.pcDat+stIms.piOfs[i]+CLPBLK_HDRSIZ,((char*)stIms.ppBlk[i])+CLPBLK_HDRSIZ,stIms.ppBlk[i]->szUsd-CLPBLK_HDRSIZ);
+      }
+      for (i=0;i<psImc->siEnt;i++) {
+         for (f=0;f<CLPIMG_FLDCNT;f++) {
+            const void* pvPtr=pvClpImgFld(psImc->ppEnt[i],f);
+            if (pvPtr!=NULL) {
+               stIms.psMap[stIms.siMap].pvPtr=pvPtr;
+               stIms.psMap[stIms.siMap].uiOrd=i;
+               stIms.psMap[stIms.siMap].uiFld=f;
+               stIms.siMap++;
+            }
+         }
+      }
+      qsort(stIms.psMap,stIms.siMap,sizeof(TsMap),siClpImgCmp);
+      if (siClpImgSym(&stIms,psHdl->psTab)==0 && siClpImgOfs(&stIms,psHdl->psTab,&stImg.uiTab)) {
+         memcpy(stImg.acMag,CLPIMG_MAGIC,sizeof(stImg.acMag));
+         stImg.uiHsh=psImc->uiHsh;
+         stImg.szDat=stIms.szDat;
+         stImg.siRel=stIms.siRel;
+         stImg.siSym=psHdl->psTpl->siSym;
+         stImg.siVar=psHdl->psTpl->siVar;
+         vdClpImgWrt(&stIms,&stImg,pcFil);
+      }
+   }
+   SAFE_FREE(stIms.ppBlk);
+   SAFE_FREE(stIms.piOfs);
+   SAFE_FREE(stIms.psMap);
+   SAFE_FREE(stIms.pcDat);
+   SAFE_FREE(stIms.psRel);
+}
+
+/* Scanner ************************************************************/
+
+#define STRCHR '\''
+#define SPMCHR '\"'
+#define ALTCHR C_GRV
+
+extern int siClpLexemes(
+   void*                         pvHdl,
+   FILE*                         pfOut)
+{
+   if (pfOut!=NULL) {
+      TsHdl* psHdl=(TsHdl*)pvHdl;
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," COMMENT   '#' [:print:]* '#'                              (will be ignored)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCOMMENT  ';' [:print:]* 'nl'                             (will be ignored)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SEPARATOR [:space: | :cntr: | ',']*                  (abbreviated with SEP)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," OPERATOR '=' | '.' | '(' | ')' | '[' | ']' | (SGN, DOT, RBO, RBC, SBO, SBC)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"  '=>'| '+' | '-' | '*' | '/' | '{' | '}' (SAB, ADD, SUB, MUL, DIV, CBO,CBC)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," KEYWORD   ['-'['-']][:alpha:]+[:alnum: | '_']*          (always predefined)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SELECTION ['-'['-']][:alpha:]+[:alnum: | '_' | '-' | '/']*     (predefined)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," NUMBER    ([+|-]  [ :digit:]+)  |                       (decimal (default))\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0b[ :digit:]+)  |                                  (binary)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0o[ :digit:]+)  |                                   (octal)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0d[ :digit:]+)  |                                 (decimal)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0x[ :xdigit:]+) |                             (hexadecimal)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," num       ([+|-]0t(yyyy/mm/tt.hh:mm:ss)) |  (relativ (+|-) or absolut time)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," FLOAT     ([+|-]  [ :digit:]+.[:digit:]+e|E[:digit:]+) | (decimal(default))\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," flt       ([+|-]0d[ :digit:]+.[:digit:]+e|E[:digit:]+)            (decimal)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," STRING         ''' [:print:]* ''' |          (default (if binary c else s))\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [s|S]''' [:print:]* ''' |                (null-terminated string)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [c|C]''' [:print:]* ''' |  (binary string in local character set)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [a|A]''' [:print:]* ''' |                (binary string in ASCII)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [e|E]''' [:print:]* ''' |               (binary string in EBCDIC)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [x|X]''' [:print:]* ''' |         (binary string in hex notation)\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," str       [f|F]''' [:print:]* ''' | (read string from file (for passwords))\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Strings can contain two '' to represent one '                    \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Strings can also be enclosed in \" or %c instead of '              \n",ALTCHR);
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Strings can directly start behind a '=' without enclosing ('%c\")  \n",ALTCHR);
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"              In this case the string ends at the next separator or operator\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"              and keywords are preferred. To use keywords, separators or    \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"              operators in strings, enclosing quotes are required.          \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"                                                                            \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," The predefined constant keyword below can be used in a value expressions   \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," NOW       NUMBER - current time in seconds since 1970 (+0t0000)            \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," MINUTE    NUMBER - minute in seconds (60)                                  \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," HOUR      NUMBER - hour in seconds   (60*60)                               \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," DAY       NUMBER - day in seconds    (24*60*60)                            \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," YEAR      NUMBER - year in seconds   (365*24*60*60)                        \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," KiB       NUMBER - kilobyte          (1024)                                \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," MiB       NUMBER - megabyte          (1024*1024)                           \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GiB       NUMBER - gigabyte          (1024*1024*1024)                      \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," TiB       NUMBER - terrabyte         (1024*1024*1024*1024)                 \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," RNDn      NUMBER - simple random number with n * 8 bit in length (1,2,4,8) \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," PI        FLOAT  - PI (3.14159265359)                                      \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCSTAMP   STRING - current local stamp in format:           YYYYMMDD.HHMMSS\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCDATE    STRING - current local date in format:            YYYYMMDD       \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCYEAR    STRING - current local year in format:            YYYY           \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCYEAR2   STRING - current local year in format:            YY             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCMONTH   STRING - current local month in format:           MM             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCDAY     STRING - current local day in format:             DD             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCTIME    STRING - current local time in format:            HHMMSS         \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCHOUR    STRING - current local hour in format:            HH             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCMINUTE  STRING - current local minute in format:          MM             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCSECOND  STRING - current local second in format:          SS             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCOFFSET  STRING - difference to Greenwich mean time:    +/-HH             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," LCOFFABS  STRING - difference to GMT (absolute):             HH             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMSTAMP   STRING - current Greenwich mean stamp in format:  YYYYMMDD.HHMMSS\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMDATE    STRING - current Greenwich mean date in format:   YYYYMMDD       \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMYEAR    STRING - current Greenwich mean year in format:   YYYY           \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMYEAR2   STRING - current Greenwich mean year in format:   YY             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMMONTH   STRING - current Greenwich mean month in format:  MM             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMDAY     STRING - current Greenwich mean day in format:    DD             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMTIME    STRING - current Greenwich mean time in format:   HHMMSS         \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMHOUR    STRING - current Greenwich mean hour in format:   HH             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMMINUTE  STRING - current Greenwich mean minute in format: MM             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMSECOND  STRING - current Greenwich mean second in format: SS             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMOFFSET  STRING - difference to local time:             +/-HH             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," GMOFFABS  STRING - difference to local time (absolute):     HH             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SnRND10   STRING - decimal random number of length n (1 to 8)              \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SnRND16   STRING - hexadecimal random number of length n (1 to 8)          \n");
+      for (int i=0;i<psHdl->siCon;i++) {
+         fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," %-9s %-6s - application specific constant\n",psHdl->psCon[i].pcKyw,
+                 (psHdl->psCon[i].siTyp==CLPTYP_NUMBER)?"NUMBER":(psHdl->psCon[i].siTyp==CLPTYP_FLOATN)?"FLOAT":"STRING");
+      }
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"                                                                            \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," SUPPLEMENT     '\"' [:print:]* '\"' |   (null-terminated string (properties))\n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Supplements can contain two \"\" to represent one \"                \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Supplements can also be enclosed in ' or %c instead of \"          \n",ALTCHR);
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"           Supplements can also be enclosed in ' or %c instead of \"          \n",ALTCHR);
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," ENVIRONMENT VARIABLES '<'varnam'>' will replaced by the corresponding value  \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," Escape sequences for critical punctuation characters on EBCDIC systems     \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '!' = '&EXC;'   - Exclamation mark                                      \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '$' = '&DLR;'   - Dollar sign                                           \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '#' = '&HSH;'   - Hashtag (number sign)                                 \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '@' = '&ATS;'   - At sign                                               \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '[' = '&SBO;'   - Square bracket open                                   \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '\\' = '&BSL;'   - Backslash                                             \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    ']' = '&SBC;'   - Square bracket close                                  \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '^' = '&CRT;'   - Caret (circumflex)                                    \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '`' = '&GRV;'   - Grave accent                                          \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '{' = '&CBO;'   - Curly bracket open                                    \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '|' = '&VBR;'   - Vertical bar                                          \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '}' = '&CBC;'   - Curly bracket close                                   \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '~' = '&TLD;'   - Tilde                                                 \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," Define CCSIDs for certain areas in CLP strings on EBCDIC systems (0-reset) \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '&' [:digit:]+ ';  (...\"&1047;get.file='&0;%%s&1047;'\",f)                \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut," Escape sequences for hexadecimal byte values                               \n");
+      fprintf(pfOut,"%s",fpcPre(psHdl,0)); efprintf(pfOut,"    '&' ['X''x'] :xdigit: :xdigit: ';' (\"&xF5;\")                            \n");
+   }
+   return(CLP_OK);
+}
+
+static inline int isPrintF(const TsSym* p) { return (p != NULL) ? (CLPISF_PWD(p->psStd->uiFlg) == FALSE) : TRUE; }
+static inline char* isPrnLex(const TsSym* p, char* l) { return (isPrintF(p)) ? l : "***SECRET***"; }
+static inline int isPrintF2(const TsSym* p) { return (CLPISF_PWD(p->psStd->uiFlg)==FALSE); }
+static inline const char* isPrnLex2(const TsSym* p, const char* l) { return (isPrintF2(p)) ? l : "***SECRET***"; }
+static inline int isStringChr(int c) { return (c == STRCHR || c == SPMCHR || c == ALTCHR); }
+static inline int isSeparation(int c) { return (isspace(c) || iscntrl(c) || c == ','); }
+static inline int isReqStrOpr1(int c) { return (c == '=' || c == '+' || c == ')' || c == C_SBC || c == C_CBC); }// required string cannot start with this characters
+static inline int isReqStrOpr2(int c) { return (c == ';' || c == C_HSH); }                                      // required string must end at this
+static inline int isReqStrOpr3(int c) { return (isReqStrOpr1(c) || c == '(' || c == '.' || c == C_SBO || c == C_CBO || isStringChr(c)); }// required string must end at key word if one of this follows
+
+/* Bulk skip for separators, comments and string literals: With SSE2 or AVX2 the input is read in aligned blocks
+ * (an aligned load never crosses a page, the bytes behind EOS in the same block are only compared) and the
+ * delimiters and new lines are found with compare masks. The rows are counted like in the scalar loop. */
+#ifdef __CLPSIMD__
+#  ifdef __AVX2__
+#     define CLPVEC_SIZ          32
+#     define CLPVEC_TYP          __m256i
+#     define CLPVEC_LOD(p)       _mm256_load_si256((const __m256i*)(p))
+#     define CLPVEC_SET(c)       _mm256_set1_epi8((char)(c))
+#     define CLPVEC_CEQ(a,b)     _mm256_cmpeq_epi8((a),(b))
+#     define CLPVEC_BOR(a,b)     _mm256_or_si256((a),(b))
+#     define CLPVEC_MSK(a)       ((U32)_mm256_movemask_epi8(a))
+#     define CLPVEC_ALL          0xFFFFFFFFU
+#  else
+#     define CLPVEC_SIZ          16
+#     define CLPVEC_TYP          __m128i
+#     define CLPVEC_LOD(p)       _mm_load_si128((const __m128i*)(p))
+#     define CLPVEC_SET(c)       _mm_set1_epi8((char)(c))
+#     define CLPVEC_CEQ(a,b)     _mm_cmpeq_epi8((a),(b))
+#     define CLPVEC_BOR(a,b)     _mm_or_si128((a),(b))
+#     define CLPVEC_MSK(a)       ((U32)_mm_movemask_epi8(a))
+#     define CLPVEC_ALL          0x0000FFFFU
+#  endif
+#  define CLPVEC_ALN(p)          ((((uintptr_t)(p))&(CLPVEC_SIZ-1))==0)
+
+__attribute__((no_sanitize_address))
+static inline const char* pcClpSkpChr(const char* pcCur, const char siChr, int* piRow, const char** ppRow)
+{
+   const CLPVEC_TYP              vcZro=CLPVEC_SET(EOS);
+   const CLPVEC_TYP              vcChr=CLPVEC_SET(siChr);
+   const CLPVEC_TYP              vcNln=CLPVEC_SET('\n');
+   while (!CLPVEC_ALN(pcCur) && *pcCur!=siChr && *pcCur!=EOS) {
+      if (*pcCur=='\n' && piRow!=NULL) { (*piRow)++; *ppRow=pcCur+1; }
+      pcCur++;
+   }
+   if (*pcCur!=siChr && *pcCur!=EOS) {
+      U32                        uiStp=0;
+      while (uiStp==0) {
+         const CLPVEC_TYP        vcBlk=CLPVEC_LOD(pcCur);
+         U32                     uiNln=CLPVEC_MSK(CLPVEC_CEQ(vcBlk,vcNln));
+         uiStp=CLPVEC_MSK(CLPVEC_BOR(CLPVEC_CEQ(vcBlk,vcZro),CLPVEC_CEQ(vcBlk,vcChr)));
+         if (uiStp) {
+            uiNln&=(uiStp&(~uiStp+1))-1; // only new lines in front of the stop character
+         }
+         if (uiNln && piRow!=NULL) {
+            (*piRow)+=__builtin_popcount(uiNln);
+            *ppRow=pcCur+(31-__builtin_clz(uiNln))+1;
+         }
+         pcCur+=(uiStp)?__builtin_ctz(uiStp):CLPVEC_SIZ;
+      }
+   }
+   return(pcCur);
+}
+
+__attribute__((no_sanitize_address))
+static inline const char* pcClpSkpSep(const char* pcCur, int* piSep, int* piRow, const char** ppRow)
+{
+   const CLPVEC_TYP              vcBlk=CLPVEC_SET(' ');
+   const CLPVEC_TYP              vcTab=CLPVEC_SET('\t');
+   const CLPVEC_TYP              vcCom=CLPVEC_SET(',');
+   const CLPVEC_TYP              vcCar=CLPVEC_SET('\r');
+   const CLPVEC_TYP              vcNln=CLPVEC_SET('\n');
+   while (*pcCur!=EOS && isSeparation(*pcCur)) {
+      U32                        uiSep=0;
+      U32                        uiNln=0;
+      if (CLPVEC_ALN(pcCur)) { // a block of common separators is skipped at once, all other cases are handled per byte
+         const CLPVEC_TYP        vcCur=CLPVEC_LOD(pcCur);
+         uiNln=CLPVEC_MSK(CLPVEC_CEQ(vcCur,vcNln));
+         uiSep=CLPVEC_MSK(CLPVEC_BOR(CLPVEC_BOR(CLPVEC_CEQ(vcCur,vcBlk),CLPVEC_CEQ(vcCur,vcTab)),
+                                     CLPVEC_BOR(CLPVEC_CEQ(vcCur,vcCom),CLPVEC_CEQ(vcCur,vcCar))))|uiNln;
+      }
+      if (uiSep==CLPVEC_ALL) {
+         if (piSep!=NULL) { *piSep=(unsigned char)pcCur[CLPVEC_SIZ-1]; }
+         if (uiNln) {
+            (*piRow)+=__builtin_popcount(uiNln);
+            *ppRow=pcCur+(31-__builtin_clz(uiNln))+1;
+         }
+         pcCur+=CLPVEC_SIZ;
+      } else {
+         if (piSep!=NULL) { *piSep=(unsigned char)(*pcCur); }
+         if (*pcCur=='\n') { (*piRow)++; *ppRow=pcCur+1; }
+         pcCur++;
+      }
+   }
+   return(pcCur);
+}
+#else
+static inline const char* pcClpSkpChr(const char* pcCur, const char siChr, int* piRow, const char** ppRow)
+{
+   while (*pcCur!=siChr && *pcCur!=EOS) {
+      if (*pcCur=='\n' && piRow!=NULL) { (*piRow)++; *ppRow=pcCur+1; }
+      pcCur++;
+   }
+   return(pcCur);
+}
+
+static inline const char* pcClpSkpSep(const char* pcCur, int* piSep, int* piRow, const char** ppRow)
+{
+   while (*pcCur!=EOS && isSeparation(*pcCur)) {
+      if (piSep!=NULL) { *piSep=(unsigned char)(*pcCur); }
+      if (*pcCur=='\n') { (*piRow)++; *ppRow=pcCur+1; }
+      pcCur++;
+   }
+   return(pcCur);
+}
+#endif
+
+#define LEX_RESERVE(n) do {\
+   if ((pcEnd-pcLex)<=(intptr_t)(n)+4) {\
+      intptr_t l=pcLex-(*ppLex);\
+      intptr_t h=pcHlp-(*ppLex);\
+      intptr_t z=(pcZro!=NULL)?pcZro-(*ppLex):0;\
+      size_t s=(((size_t)l+(n))>2*(*pzLex))?((size_t)l+(n)):2*(*pzLex);\
+      s+=CLPINI_LEXSIZ;\
+      char*  b=(char*)realloc_nowarn(*ppLex,s);\
+      if (b==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Re-allocation of buffer in size %d to store the lexeme failed",(int)s); }\
+      (*pzLex)=s;\
       if (b!=(*ppLex)) {\
          (*ppLex)=b;\
          pcLex=(*ppLex)+l;\
@@ -3911,6 +5970,175 @@ static inline int isReqStrOpr3(int c) { return (isReqStrOpr1(c) || c == '(' || c
    }\
 } while (0)
 
+#define LEX_REALLOC LEX_RESERVE(0)
+
+static inline const char* pcClpStrEnd(TsHdl* psHdl, const char* pcCur, const char USECHR, int* piEsc)
+{
+   pcCur=pcClpSkpChr(pcCur,USECHR,&psHdl->siRow,&psHdl->pcRow);
+   while (pcCur[0]==USECHR && pcCur[1]==USECHR) {
+      *piEsc=TRUE;
+      pcCur=pcClpSkpChr(pcCur+2,USECHR,&psHdl->siRow,&psHdl->pcRow);
+   }
+   return(pcCur);
+}
+
+static inline char* pcClpLexCpy(char* pcLex, const char* pcBeg, const char* pcEnd, const char USECHR)
+{
+   if (USECHR==EOS) {
+      memcpy(pcLex,pcBeg,pcEnd-pcBeg);
+      return(pcLex+(pcEnd-pcBeg));
+   }
+   while (pcBeg<pcEnd) {
+      *pcLex=*pcBeg; pcLex++;
+      pcBeg+=(*pcBeg==USECHR)?2:1;
+   }
+   return(pcLex);
+}
+
+static inline const TsCon* psClpConEnt(const TsHdl* psHdl, const int siIdx)
+{
+   return((siIdx<CLPCON_BLTCNT)?asClpCon+siIdx:psHdl->psCon+(siIdx-CLPCON_BLTCNT));
+}
+
+static inline unsigned int uiClpConHsh(const char* pcKyw, const unsigned int uiSed)
+{
+   U32            h=0x811C9DC5U^(uiSed*0x9E3779B9U);
+   for (;*pcKyw;pcKyw++) {
+      h^=(U32)toupper((unsigned char)*pcKyw); h*=0x01000193U;
+   }
+   h^=h>>15; h*=0x2C1B3C6DU; h^=h>>12;
+   return(h);
+}
+
+/* Builds a case insensitive perfect hash over the built-in and the application constants (hash and displace):
+ * The keywords are distributed to buckets with seed 0, then for each bucket (largest first) a displacement is
+ * searched which maps all keywords of the bucket to free slots. A lookup costs two hashes and one compare. */
+static void vdClpConIdx(
+   TsHdl*                        psHdl)
+{
+   const int                     siCnt=CLPCON_BLTCNT+psHdl->siCon;
+   unsigned int                  uiSlt=CLPINI_CSLCNT;
+   unsigned int                  uiBkt=siCnt/2+1;
+   int*                          piHed=(int*)malloc(uiBkt*sizeof(int));
+   int*                          piNxt=(int*)malloc(siCnt*sizeof(int));
+   int*                          piLen=(int*)calloc(uiBkt,sizeof(int));
+   int                           siMax=0;
+   int                           isOk=FALSE;
+   int                           i;
+
+   SAFE_FREE(psHdl->puCds);
+   SAFE_FREE(psHdl->piCsl);
+   psHdl->uiCmk=0;
+   psHdl->uiCbk=0;
+   if (piHed!=NULL && piNxt!=NULL && piLen!=NULL) {
+      for (i=0;i<(int)uiBkt;i++) { piHed[i]=-1; }
+      for (i=0;i<siCnt;i++) {
+         unsigned int b=uiClpConHsh(psClpConEnt(psHdl,i)->pcKyw,0)%uiBkt;
+         piNxt[i]=piHed[b]; piHed[b]=i; piLen[b]++;
+         if (piLen[b]>siMax) { siMax=piLen[b]; }
+      }
+      while (uiSlt<(unsigned int)(2*siCnt)) { uiSlt*=2; }
+      while (!isOk && uiSlt<=0x00100000U) {
+         unsigned int* puCds=(unsigned int*)calloc(uiBkt,sizeof(unsigned int));
+         int*          piCsl=(int*)malloc(uiSlt*sizeof(int));
+         int           siLen;
+         if (puCds==NULL || piCsl==NULL) {
+            SAFE_FREE(puCds);
+            SAFE_FREE(piCsl);
+            break;
+         }
+         for (i=0;i<(int)uiSlt;i++) { piCsl[i]=-1; }
+         isOk=TRUE;
+         for (siLen=siMax;siLen>0 && isOk;siLen--) {
+            unsigned int b;
+            for (b=0;b<uiBkt && isOk;b++) {
+               if (piLen[b]==siLen) {
+                  unsigned int d;
+                  int          isFit=FALSE;
+                  for (d=1;d<=0x00010000U && !isFit;d++) {
+                     int j=piHed[b];
+                     isFit=TRUE;
+                     while (j>=0 && isFit) {
+                        unsigned int s=uiClpConHsh(psClpConEnt(psHdl,j)->pcKyw,d)&(uiSlt-1);
+                        if (piCsl[s]>=0) {
+                           isFit=FALSE;
+                        } else {
+                           piCsl[s]=j;
+                           j=piNxt[j];
+                        }
+                     }
+                     if (isFit) {
+                        puCds[b]=d;
+                     } else {
+                        int k;
+                        for (k=piHed[b];k!=j;k=piNxt[k]) { // release the slots of this try
+                           piCsl[uiClpConHsh(psClpConEnt(psHdl,k)->pcKyw,d)&(uiSlt-1)]=-1;
+                        }
+                     }
+                  }
+                  isOk=isFit;
+               }
+            }
+         }
+         if (isOk) {
+            psHdl->puCds=puCds;
+            psHdl->piCsl=piCsl;
+            psHdl->uiCbk=uiBkt;
+            psHdl->uiCmk=uiSlt-1;
+         } else {
+            free(puCds);
+            free(piCsl);
+            uiSlt*=2;
+         }
+      }
+   }
+   SAFE_FREE(piHed);
+   SAFE_FREE(piNxt);
+   SAFE_FREE(piLen);
+}
+
+static int siClpConFnd(
+   TsHdl*                        psHdl,
+   const int                     isCas,
+   const char*                   pcKyw)
+{
+   int                           i;
+   if (psHdl->uiCmk==0) {
+      vdClpConIdx(psHdl);
+   }
+   if (psHdl->uiCmk) {
+      unsigned int d=psHdl->puCds[uiClpConHsh(pcKyw,0)%psHdl->uiCbk];
+      i=psHdl->piCsl[uiClpConHsh(pcKyw,d)&psHdl->uiCmk];
+      if (i>=0 && strxcmp(isCas,pcKyw,psClpConEnt(psHdl,i)->pcKyw,0,0,FALSE)==0) {
+         return(i);
+      }
+   } else { // no index available (out of memory)
+      for (i=0;i<CLPCON_BLTCNT+psHdl->siCon;i++) {
+         if (strxcmp(isCas,pcKyw,psClpConEnt(psHdl,i)->pcKyw,0,0,FALSE)==0) {
+            return(i);
+         }
+      }
+   }
+   return(-1);
+}
+
+static void vdClpConFre(
+   TsHdl*                        psHdl)
+{
+   int                           i;
+   for (i=0;i<psHdl->siCon;i++) {
+      free((char*)psHdl->psCon[i].pcKyw);
+      SAFE_FREE(psHdl->psCon[i].pcStr);
+   }
+   SAFE_FREE(psHdl->psCon);
+   psHdl->siCon=0;
+   psHdl->szCon=0;
+   SAFE_FREE(psHdl->puCds);
+   SAFE_FREE(psHdl->piCsl);
+   psHdl->uiCmk=0;
+   psHdl->uiCbk=0;
+}
+
 static int siClpConNat(
    TsHdl*                        psHdl,
    FILE*                         pfErr,
@@ -3921,448 +6149,114 @@ static int siClpConNat(
    const int                     siTyp,
    const TsSym*                  psArg)
 {
+   const TsCon*                  psCon;
+   int                           siIdx;
    (void)pfErr;
-   if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"NOW",0,0,FALSE)==0) {
-      if (pzLex!=NULL && ppLex!=NULL) {
+   siIdx=siClpConFnd(psHdl,psHdl->isCas,pcKyw);
+   if (siIdx<0) {
+      return(CLPTOK_KYW);
+   }
+   psCon=psClpConEnt(psHdl,siIdx);
+   if (siTyp!=psCon->siTyp && siTyp!=-1) {
+      return(CLPTOK_KYW);
+   }
+   if (pzLex!=NULL && (ppLex!=NULL || psCon->siKnd!=CLPCON_NOW)) {
+      struct tm                  st;
+      time_t                     t=psHdl->siNow;
+      if (psCon->siKnd!=CLPCON_NUM && psCon->siKnd!=CLPCON_FLT && psCon->siKnd!=CLPCON_STR) {
+         psHdl->uiDyn++;
+      }
+      switch (psCon->siKnd) {
+      case CLPCON_NOW:
          srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)psHdl->siNow));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-         if (psArg!=NULL) { psArg->psStd->uiFlg|=CLPFLG_TIM; }
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"MINUTE",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)60));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"HOUR",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)60)*((U64)60));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"DAY",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)24)*((U64)60)*((U64)60));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"YEAR",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)365)*((U64)24)*((U64)60)*((U64)60));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"KiB",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)1024));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"MiB",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)1024)*((U64)1024));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GiB",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)1024)*((U64)1024)*((U64)1024));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"TiB",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%"PRIu64"",((U64)1024)*((U64)1024)*((U64)1024)*((U64)1024));
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"RND8",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         if (psHdl->siRnd>=0) {
-            srprintf(ppLex,pzLex,24,"d+%"PRIi64"",psHdl->siRnd);
+         if (psArg!=NULL) { vdClpDflSet(psHdl,psArg,CLPFLG_TIM); }
+         break;
+      case CLPCON_NUM:
+         if (psCon->siNum>=0) {
+            srprintf(ppLex,pzLex,24,"d+%"PRIi64"",psCon->siNum);
          } else {
-            srprintf(ppLex,pzLex,24,"d%"PRIi64"",psHdl->siRnd);
+            srprintf(ppLex,pzLex,24,"d%"PRIi64"",psCon->siNum);
          }
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"RND4",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
+         break;
+      case CLPCON_RND: {
+         I64 siRnd;
          psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         I32   siRnd=(I32)psHdl->siRnd;
-         if (siRnd>=0) {
-            srprintf(ppLex,pzLex,24,"d+%d",siRnd);
-         } else {
-            srprintf(ppLex,pzLex,24,"d%d",siRnd);
+         switch (psCon->siNum) {
+         case 1:  siRnd=(I08)psHdl->siRnd; break;
+         case 2:  siRnd=(I16)psHdl->siRnd; break;
+         case 4:  siRnd=(I32)psHdl->siRnd; break;
+         default: siRnd=psHdl->siRnd;      break;
          }
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"RND2",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         I16   siRnd=(I16)psHdl->siRnd;
          if (siRnd>=0) {
-            srprintf(ppLex,pzLex,24,"d+%d",(I32)siRnd);
+            srprintf(ppLex,pzLex,24,"d+%"PRIi64"",siRnd);
          } else {
-            srprintf(ppLex,pzLex,24,"d%d",(I32)siRnd);
+            srprintf(ppLex,pzLex,24,"d%"PRIi64"",siRnd);
          }
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_NUMBER || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"RND1",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         I08   siRnd=(I08)psHdl->siRnd;
-         if (siRnd>=0) {
-            srprintf(ppLex,pzLex,24,"d+%d",(I32)siRnd);
+      } break;
+      case CLPCON_FLT:
+         if (psCon->flNum>=0.0) {
+            srprintf(ppLex,pzLex,24,"d+%f",psCon->flNum);
          } else {
-            srprintf(ppLex,pzLex,24,"d%d",(I32)siRnd);
+            srprintf(ppLex,pzLex,24,"d%f",psCon->flNum);
          }
-         TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_NUM);
-   } else if ((siTyp==CLPTYP_FLOATN || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"PI",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         srprintf(ppLex,pzLex,24,"d+%f",3.14159265359);
          for (char* p=*ppLex;*p;p++) {
             if (*p==',') { *p='.'; }
          }
-         TRACE(pfTrc,"CONSTANT-TOKEN(FLT)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_FLT);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCSTAMP",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%Y%m%d.%H%M%S",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCDATE",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%Y%m%d",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCYEAR",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%Y",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCYEAR2",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%y",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCMONTH",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%m",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCDAY",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%d",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCTIME",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%H%M%S",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCHOUR",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%H",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCMINUTE",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%M",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCSECOND",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%S",localtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCOFFSET",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm st;
-         const time_t t=psHdl->siNow;
-         const I64 lt=localtime_r(&t,&st)->tm_hour;
-         const I64 gt=gmtime_r(&t,&st)->tm_hour;
-         if (gt>=lt) {
-            snprintf(*ppLex,*pzLex,"d'+%02d",(I32)(gt-lt));
-         } else {
-            snprintf(*ppLex,*pzLex,"d'-%02d",(I32)(lt-gt));
-         }
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"LCOFFABS",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm st;
-         const time_t t=psHdl->siNow;
-         const I64 lt=localtime_r(&t,&st)->tm_hour;
-         const I64 gt=gmtime_r(&t,&st)->tm_hour;
-         if (gt>lt) {
-            snprintf(*ppLex,*pzLex,"d'%02d",(I32)(gt-lt));
-         } else {
-            snprintf(*ppLex,*pzLex,"d'%02d",(I32)(lt-gt));
-         }
-   TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMSTAMP",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%Y%m%d.%H%M%S",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMDATE",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%Y%m%d",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMYEAR",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%Y",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMYEAR2",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%y",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMMONTH",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%m",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMDAY",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%d",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMTIME",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%H%M%S",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMHOUR",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%H",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMMINUTE",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%M",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMSECOND",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm   st;
-         time_t      t=psHdl->siNow;
-         strftime(*ppLex,*pzLex,"d'%S",gmtime_r(&t,&st));
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMOFFSET",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm st;
-         const time_t t=psHdl->siNow;
-         const I64 lt=localtime_r(&t,&st)->tm_hour;
-         const I64 gt=gmtime_r(&t,&st)->tm_hour;
-         if (gt>lt) {
-            snprintf(*ppLex,*pzLex,"d'-%02d",(I32)(gt-lt));
-         } else {
-            snprintf(*ppLex,*pzLex,"d'+%02d",(I32)(lt-gt));
-         }
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"GMOFFABS",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         struct tm st;
-         const time_t t=psHdl->siNow;
+         break;
+      case CLPCON_STR:
+         srprintf(ppLex,pzLex,strlen(psCon->pcStr)+2,"d'%s",psCon->pcStr);
+         break;
+      case CLPCON_LCT:
+         strftime(*ppLex,*pzLex,psCon->pcStr,localtime_r(&t,&st));
+         break;
+      case CLPCON_GMT:
+         strftime(*ppLex,*pzLex,psCon->pcStr,gmtime_r(&t,&st));
+         break;
+      case CLPCON_R10: {
+         U32 uiMod=10;
+         int j;
+         for (j=1;j<psCon->siNum;j++) { uiMod*=10; }
+         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
+         srprintf(ppLex,pzLex,10,"d'%0*u",(int)psCon->siNum,((U32)psHdl->siRnd)%uiMod);
+      } break;
+      case CLPCON_R16:
+         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
+         srprintf(ppLex,pzLex,10,"d'%0*x",(int)psCon->siNum,((U32)psHdl->siRnd)&(0xFFFFFFFFU>>(32-4*psCon->siNum)));
+         break;
+      default: { // time zone offsets
          const I64 lt=localtime_r(&t,&st)->tm_hour;
          const I64 gt=gmtime_r(&t,&st)->tm_hour;
-         if (gt>lt) {
-            snprintf(*ppLex,*pzLex,"d'%02d",(I32)(gt-lt));
-         } else {
-            snprintf(*ppLex,*pzLex,"d'%02d",(I32)(lt-gt));
+         switch (psCon->siKnd) {
+         case CLPCON_LOF:
+            if (gt>=lt) {
+               snprintf(*ppLex,*pzLex,"d'+%02d",(I32)(gt-lt));
+            } else {
+               snprintf(*ppLex,*pzLex,"d'-%02d",(I32)(lt-gt));
+            }
+            break;
+         case CLPCON_GOF:
+            if (gt>lt) {
+               snprintf(*ppLex,*pzLex,"d'-%02d",(I32)(gt-lt));
+            } else {
+               snprintf(*ppLex,*pzLex,"d'+%02d",(I32)(lt-gt));
+            }
+            break;
+         default:
+            snprintf(*ppLex,*pzLex,"d'%02d",(I32)((gt>lt)?(gt-lt):(lt-gt)));
+            break;
          }
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S1RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%01u",((U32)psHdl->siRnd)%10);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S2RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%02u",((U32)psHdl->siRnd)%100);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S3RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%03u",((U32)psHdl->siRnd)%1000);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S4RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%04u",((U32)psHdl->siRnd)%10000);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S5RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%05u",((U32)psHdl->siRnd)%100000);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S6RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%06u",((U32)psHdl->siRnd)%1000000);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S7RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%07u",((U32)psHdl->siRnd)%10000000);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S8RND10",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%08u",((U32)psHdl->siRnd)%100000000);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
+      } break;
       }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S1RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%01x",((U32)psHdl->siRnd)&0x0000000F);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S2RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%02x",((U32)psHdl->siRnd)&0x000000FF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S3RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%03x",((U32)psHdl->siRnd)&0x00000FFF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S4RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%04x",((U32)psHdl->siRnd)&0x0000FFFF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S5RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%05x",((U32)psHdl->siRnd)&0x000FFFFF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S6RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%06x",((U32)psHdl->siRnd)&0x00FFFFFF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S7RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%07x",((U32)psHdl->siRnd)&0x0FFFFFFF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
-      }
-      return(CLPTOK_STR);
-   } else if ((siTyp==CLPTYP_STRING || siTyp==-1) && strxcmp(psHdl->isCas,pcKyw,"S8RND16",0,0,FALSE)==0) {
-      if (pzLex!=NULL) {
-         psHdl->siRnd=ClpRndFnv((psHdl->siRnd+1)^flrand());
-         srprintf(ppLex,pzLex,10,"d'%08x",((U32)psHdl->siRnd)&0xFFFFFFFF);
-         TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex);
+      switch (psCon->siTyp) {
+      case CLPTYP_NUMBER: TRACE(pfTrc,"CONSTANT-TOKEN(NUM)-LEXEME(%s)\n",*ppLex); break;
+      case CLPTYP_FLOATN: TRACE(pfTrc,"CONSTANT-TOKEN(FLT)-LEXEME(%s)\n",*ppLex); break;
+      default:            TRACE(pfTrc,"CONSTANT-TOKEN(STR)-LEXEME(%s)\n",*ppLex); break;
       }
-      return(CLPTOK_STR);
-   } else {
-      return(CLPTOK_KYW);
+   }
+   switch (psCon->siTyp) {
+   case CLPTYP_NUMBER: return(CLPTOK_NUM);
+   case CLPTYP_FLOATN: return(CLPTOK_FLT);
+   default:            return(CLPTOK_STR);
    }
 }
 
@@ -4375,19 +6269,13 @@ static inline int siClpNxtOpr(
       } else if (isSeparation(*pcCur)) { /*separation*/
          pcCur++;
       } else if (*pcCur==C_HSH) { /*comment*/
-         pcCur++;
-         while (*pcCur!=C_HSH && *pcCur!=EOS) {
-            pcCur++;
-         }
+         pcCur=pcClpSkpChr(pcCur+1,C_HSH,NULL,NULL);
          if (*pcCur!=C_HSH) {
             return(0x00);
          }
          pcCur++;
       } else if (*pcCur==';') { /*line comment*/
-         pcCur++;
-         while (*pcCur!='\n' && *pcCur!=EOS) {
-            pcCur++;
-         }
+         pcCur=pcClpSkpChr(pcCur+1,'\n',NULL,NULL);
       } else {
          return(*pcCur);
       }
@@ -4474,55 +6362,380 @@ static inline int isClpKywStr(
          return(TRUE);
       }
    }
-   return(CLPTOK_KYW!=siClpConNat(psHdl,pfErr,pfTrc,pcKyw,NULL,NULL,CLPTYP_STRING,psArg));
+   return(CLPTOK_KYW!=siClpConNat(psHdl,pfErr,pfTrc,pcKyw,NULL,NULL,CLPTYP_STRING,psArg));
+}
+
+static inline int isClpKywAry(
+   TsHdl*                        psHdl,
+   const int                     siTok,
+   const char*                   pcKyw,
+   const TsSym*                  psArg,
+   const TsSym**                 ppVal)
+{
+   const TsSym*                  psVal=NULL;
+   if (ppVal!=NULL) {
+      if (*ppVal!=NULL) {
+         int siOpr=siClpNxtOpr(psHdl->pcCur);
+         if ((*ppVal)->psFix->siTyp==psArg->psFix->siTyp && siOpr!='=' && siOpr!='(' && siOpr!='.' && siOpr!=C_SBO) {
+            return(TRUE);
+         } else {
+            return(FALSE);
+         }
+      }
+   }
+   if (psArg!=NULL) {
+      if (psArg->psDep!=NULL) { // selection
+         psVal=psClpFndSym(psHdl,pcKyw,psArg->psDep);
+      }
+      if (psVal==NULL && !CLPISF_SEL(psArg->psStd->uiFlg)) {
+         psVal=psClpFndSym2(psHdl,pcKyw,psArg);
+      }
+      if (psVal!=NULL) {
+         if (ppVal!=NULL) { *ppVal=psVal; }
+         int siOpr=siClpNxtOpr(psHdl->pcCur);
+         if (psVal->psFix->siTyp==psArg->psFix->siTyp && siOpr!='=' && siOpr!='(' && siOpr!='.' && siOpr!=C_SBO) {
+            return(TRUE);
+         } else {
+            return(FALSE);
+         }
+      }
+      return(siTok==siClpConNat(psHdl,psHdl->pfErr,NULL,pcKyw,NULL,NULL,psArg->psFix->siTyp,psArg));
+   }
+   return(FALSE);
+}
+
+/* If the input contains nothing to un-escape, it is scanned in place (if no copy is required, because
+ * the input is released before scanning), else only the part behind the unchanged prefix is processed.*/
+static const char* pcClpUnEscape(
+   TsHdl*                        psHdl,
+   const char*                   pcInp,
+   const int                     isCpy)
+{
+   int      siInd;
+   size_t   szSpn;
+   char*    pcOut;
+   TsDiaChr stDia;
+   env_diachr(&stDia);
+   szSpn=unEscapeSpn(pcInp,&stDia);
+   if (pcInp[szSpn]==EOS && !isCpy) { return(pcInp); }
+   pcOut=(char*)pvClpAllocFlg(psHdl,NULL,szSpn+strlen(pcInp+szSpn)+1,&siInd,CLPFLG_PWD);
+   if (pcOut==NULL) { return(pcOut); }
+   psHdl->psPtr[siInd].isTmp=TRUE;
+   memcpy(pcOut,pcInp,szSpn);
+   unEscapeStm(pcInp+szSpn,pcOut+szSpn,&stDia,TRUE,NULL);
+   return(pcOut);
+}
+
+/* Parameter files are read in chunks of CLPINI_STMSIZ through a window (the buffer of the nesting level),
+ * so the memory does not scale with the file size. Before each token the window is filled until the
+ * complete token, the following separators and comments and the next operator are available (the
+ * scanner and siClpNxtOpr() never read behind this), the already scanned part in front of the
+ * current row is discarded and counted in szInp. If the current row itself becomes too long, the
+ * front of the row is also discarded and counted in szRow to keep the column for error messages.*/
+static int siClpBufLev(
+   TsHdl*                        psHdl)
+{
+   if (psHdl->siBuf>=psHdl->szBuf) {
+      int                        szBuf=(psHdl->szBuf)?psHdl->szBuf:CLPINI_BUFCNT;
+      void*                      pvHlp;
+      while (szBuf<=psHdl->siBuf) { szBuf*=2; }
+      pvHlp=realloc_nowarn(psHdl->apBuf,sizeof(char*)*szBuf);
+      if (pvHlp==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Allocation of buffer list for nested input failed"); }
+      psHdl->apBuf=(char**)pvHlp;
+      pvHlp=realloc_nowarn(psHdl->pzBuf,sizeof(size_t)*szBuf);
+      if (pvHlp==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Allocation of buffer list for nested input failed"); }
+      psHdl->pzBuf=(size_t*)pvHlp;
+      for (int i=psHdl->szBuf;i<szBuf;i++) {
+         psHdl->apBuf[i]=NULL;
+         psHdl->pzBuf[i]=0;
+      }
+      psHdl->szBuf=szBuf;
+   }
+   return(CLP_OK);
+}
+
+static inline TsStm* psClpStmAct(
+   const TsHdl*                  psHdl)
+{
+   return((psHdl->psStm!=NULL && psHdl->psStm->siBuf==psHdl->siBuf)?psHdl->psStm:NULL);
+}
+
+static int siClpStmOpn(
+   TsHdl*                        psHdl,
+   FILE*                         pfFil)
+{
+   TsStm*                        psStm=(TsStm*)calloc(1,sizeof(TsStm));
+   int                           siErr;
+   if (psStm==NULL) {
+      fclose_unchecked(pfFil);
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of stream for parameter file failed");
+   }
+   psStm->pfFil=pfFil;
+   psStm->siBuf=psHdl->siBuf;
+   psStm->psNxt=psHdl->psStm;
+   psHdl->psStm=psStm;
+   psStm->szRaw=CLPINI_STMSIZ+1;
+   psStm->pcRaw=(char*)malloc(psStm->szRaw);
+   if (psStm->pcRaw==NULL) {
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of read buffer in size %d for parameter file failed",(int)psStm->szRaw);
+   }
+   siErr=siClpBufLev(psHdl);
+   if (siErr<0) { return(siErr); }
+   if (psHdl->pzBuf[psHdl->siBuf]<2*CLPINI_STMSIZ+1) {
+      SAFE_FREE(psHdl->apBuf[psHdl->siBuf]);
+      psHdl->pzBuf[psHdl->siBuf]=0;
+      psHdl->apBuf[psHdl->siBuf]=(char*)malloc(2*CLPINI_STMSIZ+1);
+      if (psHdl->apBuf[psHdl->siBuf]==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of buffer in size %d for parameter file failed",2*CLPINI_STMSIZ+1);
+      }
+      psHdl->pzBuf[psHdl->siBuf]=2*CLPINI_STMSIZ+1;
+   }
+   psHdl->apBuf[psHdl->siBuf][0]=EOS;
+   psStm->pcEnd=psHdl->apBuf[psHdl->siBuf];
+   env_diachr(&psStm->stDia);
+   psHdl->pcInp=psStm->pcEnd;
+   psHdl->pcCur=psStm->pcEnd;
+   psHdl->pcOld=psStm->pcEnd;
+   psHdl->pcRow=psStm->pcEnd;
+   return(CLP_OK);
+}
+
+static void vdClpStmFre(
+   TsHdl*                        psHdl,
+   const int                     isAll)
+{
+   int                           isEnd=FALSE;
+   while (psHdl->psStm!=NULL && !isEnd) {
+      TsStm*                     psStm=psHdl->psStm;
+      psHdl->psStm=psStm->psNxt;
+      if (psStm->pfFil!=NULL) { fclose_unchecked(psStm->pfFil); }
+      if (psStm->pcRaw!=NULL) {
+         memset(psStm->pcRaw,0,psStm->szRaw);
+         free(psStm->pcRaw);
+      }
+      if (psStm->siBuf<psHdl->szBuf && psHdl->apBuf[psStm->siBuf]!=NULL) {
+         memset(psHdl->apBuf[psStm->siBuf],0,psHdl->pzBuf[psStm->siBuf]);
+      }
+      free(psStm);
+      isEnd=!isAll;
+   }
+}
+
+static int siClpStmRed(
+   TsHdl*                        psHdl,
+   TsStm*                        psStm,
+   const int                     isMov)
+{
+   char*                         pcBuf=psHdl->apBuf[psHdl->siBuf];
+   size_t                        szBuf=psHdl->pzBuf[psHdl->siBuf];
+   const char*                   pcKep=(psHdl->pcRow<psHdl->pcOld)?psHdl->pcRow:psHdl->pcOld;
+   const char*                   pcRst;
+   size_t                        szKep,szReq,szRed,szChk;
+
+   if (isMov && pcKep==psHdl->pcRow && psHdl->pcOld-psHdl->pcRow>CLPINI_STMSIZ) {
+      if (psStm->pcRcl!=psHdl->pcRow) { psStm->szRow=0; }
+      psStm->szRow+=psHdl->pcOld-psHdl->pcRow;
+      psHdl->pcRow=psHdl->pcOld;
+      psStm->pcRcl=psHdl->pcRow;
+      pcKep=psHdl->pcRow;
+   }
+   szKep=psStm->pcEnd-pcKep;
+   // the chunk grows with the kept part, so a long token is checked by siClpStmFil() only a logarithmic number of times
+   szChk=(isMov && szKep>CLPINI_STMSIZ)?szKep:CLPINI_STMSIZ;
+   if (psStm->siRaw+szChk+1>psStm->szRaw) {
+      if (!isMov) { return(CLP_OK); }
+      size_t                     szRaw=2*(psStm->siRaw+szChk+1);
+      char*                      pcRaw=(char*)malloc(szRaw);
+      if (pcRaw==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Allocation of read buffer in size %d for parameter file failed",(int)szRaw); }
+      memcpy(pcRaw,psStm->pcRaw,psStm->siRaw);
+      memset(psStm->pcRaw,0,psStm->szRaw);
+      free(psStm->pcRaw);
+      psStm->pcRaw=pcRaw;
+      psStm->szRaw=szRaw;
+   }
+   szReq=szKep+psStm->siRaw+szChk+1;
+   if ((size_t)(pcKep-pcBuf)+szReq>szBuf) {
+      char*                      pcNew=pcBuf;
+      if (!isMov) { return(CLP_OK); }
+      if (szReq>szBuf) {
+         szBuf=2*szReq;
+         pcNew=(char*)malloc(szBuf);
+         if (pcNew==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Allocation of buffer in size %d for parameter file failed",(int)szBuf); }
+         memcpy(pcNew,pcKep,szKep+1);
+         memset(pcBuf,0,psHdl->pzBuf[psHdl->siBuf]);
+         free(pcBuf);
+         psHdl->apBuf[psHdl->siBuf]=pcNew;
+         psHdl->pzBuf[psHdl->siBuf]=szBuf;
+      } else {
+         memmove(pcNew,pcKep,szKep+1);
+      }
+      if (psStm->pcRcl==psHdl->pcRow) {
+         psStm->pcRcl=pcNew+(psHdl->pcRow-pcKep);
+      } else {
+         psStm->pcRcl=NULL;
+         psStm->szRow=0;
+      }
+      psHdl->szInp+=pcKep-psHdl->pcInp;
+      psHdl->pcInp=pcNew;
+      psHdl->pcCur=pcNew+(psHdl->pcCur-pcKep);
+      psHdl->pcOld=pcNew+(psHdl->pcOld-pcKep);
+      psHdl->pcRow=pcNew+(psHdl->pcRow-pcKep);
+      psStm->pcEnd=pcNew+szKep;
+   }
+   errno=0;
+   szRed=fread(psStm->pcRaw+psStm->siRaw,1,szChk,psStm->pfFil);
+   if (szRed<szChk) {
+      if (ferror(psStm->pfFil)) {
+         return CLPERR(psHdl,CLPERR_SYS,"Read of parameter file failed (%d - %s)",errno,pcSysError(errno));
+      }
+      psStm->isEof=TRUE;
+   }
+   if (memchr(psStm->pcRaw+psStm->siRaw,EOS,szRed)!=NULL) { // the content of a file ends at the first null like with a string
+      szRed=strlen(psStm->pcRaw+psStm->siRaw);
+      psStm->isEof=TRUE;
+   }
+   szRed+=psStm->siRaw;
+   psStm->pcRaw[szRed]=EOS;
+   psStm->pcEnd=unEscapeStm(psStm->pcRaw,(char*)psStm->pcEnd,&psStm->stDia,psStm->isEof,&pcRst);
+   psStm->siRaw=szRed-(pcRst-psStm->pcRaw);
+   if (psStm->siRaw) {
+      memmove(psStm->pcRaw,pcRst,psStm->siRaw);
+   }
+   return(CLP_OK);
 }
 
-static inline int isClpKywAry(
+static inline const char* pcClpStmJnk(
    TsHdl*                        psHdl,
-   const int                     siTok,
-   const char*                   pcKyw,
-   const TsSym*                  psArg,
-   const TsSym**                 ppVal)
+   const char*                   p,
+   const char*                   e)
 {
-   const TsSym*                  psVal=NULL;
-   if (ppVal!=NULL) {
-      if (*ppVal!=NULL) {
-         int siOpr=siClpNxtOpr(psHdl->pcCur);
-         if ((*ppVal)->psFix->siTyp==psArg->psFix->siTyp && siOpr!='=' && siOpr!='(' && siOpr!='.' && siOpr!=C_SBO) {
-            return(TRUE);
-         } else {
-            return(FALSE);
-         }
+   while (p<e) {
+      if (isSeparation(*p)) {
+         p++;
+      } else if (*p==C_HSH || *p==';' || (psHdl->isEnv && *p=='<')) {
+         const char*             q=memchr(p+1,(*p==C_HSH)?C_HSH:((*p==';')?'\n':'>'),e-(p+1));
+         if (q==NULL) { return(NULL); }
+         p=q+1;
+      } else {
+         return(p);
       }
    }
-   if (psArg!=NULL) {
-      if (psArg->psDep!=NULL) { // selection
-         psVal=psClpFndSym(psHdl,pcKyw,psArg->psDep);
+   return(NULL);
+}
+
+static inline int isClpStmRdy(
+   TsHdl*                        psHdl,
+   const TsStm*                  psStm)
+{
+   const char*                   e=psStm->pcEnd;
+   const char*                   p=pcClpStmJnk(psHdl,psHdl->pcCur,e);
+   if (p==NULL) { return(FALSE); }
+   if (isStringChr(p[0]) || (isalpha(p[0]) && isStringChr(p[1]))) {
+      const char                 c=isStringChr(p[0])?p[0]:p[1];
+      const char*                q=memchr(p+(isStringChr(p[0])?1:2),c,e-(p+(isStringChr(p[0])?1:2)));
+      while (q!=NULL && q+1<e && q[1]==c) {
+         q=memchr(q+2,c,e-(q+2));
+      }
+      if (q==NULL || q+1>=e) { return(FALSE); }
+      p=q+1;
+   } else {
+      while (p<e && !isSeparation(*p) && *p!=C_HSH && *p!=';') {
+         p++;
       }
-      if (psVal==NULL && !CLPISF_SEL(psArg->psStd->uiFlg)) {
-         psVal=psClpFndSym2(psHdl,pcKyw,psArg);
+   }
+   return(pcClpStmJnk(psHdl,p,e)!=NULL);
+}
+
+static int siClpStmFil(
+   TsHdl*                        psHdl)
+{
+   TsStm*                        psStm=psClpStmAct(psHdl);
+   if (psStm!=NULL) {
+      while (!psStm->isEof && !isClpStmRdy(psHdl,psStm)) {
+         int siErr=siClpStmRed(psHdl,psStm,TRUE);
+         if (siErr<0) { return(siErr); }
       }
-      if (psVal!=NULL) {
-         if (ppVal!=NULL) { *ppVal=psVal; }
-         int siOpr=siClpNxtOpr(psHdl->pcCur);
-         if (psVal->psFix->siTyp==psArg->psFix->siTyp && siOpr!='=' && siOpr!='(' && siOpr!='.' && siOpr!=C_SBO) {
-            return(TRUE);
-         } else {
-            return(FALSE);
+   }
+   return(CLP_OK);
+}
+
+static void vdClpStmRow(
+   TsHdl*                        psHdl)
+{
+   TsStm*                        psStm=psClpStmAct(psHdl);
+   if (psStm!=NULL && psHdl->pcRow!=NULL && psHdl->pcCur!=NULL) {
+      const char*                p=psHdl->pcCur;
+      const char*                e=psStm->pcEnd;
+      while (p<e && !iscntrl(*p)) { p++; }
+      while (p>=psStm->pcEnd && !psStm->isEof && psStm->pcEnd-psHdl->pcCur<CLPINI_STMSIZ) {
+         if (siClpStmRed(psHdl,psStm,FALSE)<0 || e==psStm->pcEnd) {
+            return;
          }
+         e=psStm->pcEnd;
+         while (p<e && !iscntrl(*p)) { p++; }
       }
-      return(siTok==siClpConNat(psHdl,psHdl->pfErr,NULL,pcKyw,NULL,NULL,psArg->psFix->siTyp,psArg));
    }
-   return(FALSE);
 }
 
-static char* pcClpUnEscape(
+/* Replace the part pcBeg to pcEnd of the current input by the value of the environment variable.
+ * Each nesting level (siBuf) owns one buffer with the not yet scanned rest at the end. The value
+ * and the current row in front of it are placed before the rest, the part in front of the current
+ * row is discarded and counted in szInp. Only if this space is too small, the rest is copied into
+ * a new buffer with twice the required size, so the replacements scale linear with the input.*/
+static int siClpEnvRep(
    TsHdl*                        psHdl,
-   const char*                   pcInp)
+   FILE*                         pfTrc,
+   const char*                   pcBeg,
+   const char*                   pcEnd,
+   const char*                   pcEnv,
+   const char**                  ppCur)
 {
-   char* pcOut=(char*)pvClpAllocFlg(psHdl,NULL,strlen(pcInp)+1,NULL,CLPFLG_PWD);
-   if (pcOut==NULL) { return(pcOut); }
-   return(unEscape(pcInp,pcOut));
+   const char*                   pcRow=pcBeg;
+   size_t                        szEnv=strlen(pcEnv);
+   size_t                        szPre;
+   char*                         pcNew;
+   TsStm*                        psStm=psClpStmAct(psHdl);
+   int                           siErr;
+
+   if (psHdl->pcInp!=NULL && psHdl->pcRow!=NULL && psHdl->pcRow>=psHdl->pcInp && psHdl->pcRow<=pcBeg) {
+      pcRow=psHdl->pcRow;
+   }
+   szPre=pcBeg-pcRow;
+   siErr=siClpBufLev(psHdl);
+   if (siErr<0) { return(siErr); }
+   TRACE(pfTrc,"SCANNER-ENVARREP\n%s %s\n",fpcPre(psHdl,0),(psHdl->pcInp!=NULL)?psHdl->pcInp:"");
+   pcNew=psHdl->apBuf[psHdl->siBuf];
+   if (pcNew!=NULL && pcEnd>pcNew && pcEnd<pcNew+psHdl->pzBuf[psHdl->siBuf] && (size_t)(pcEnd-pcNew)>=szPre+szEnv) {
+      pcNew+=(pcEnd-pcNew)-(szPre+szEnv);
+      memmove(pcNew,pcRow,szPre);
+      memcpy(pcNew+szPre,pcEnv,szEnv);
+   } else {
+      size_t                     szRst=strlen(pcEnd)+1;
+      size_t                     szBuf=2*(szPre+szEnv+szRst);
+      char*                      pcBuf=(char*)malloc(szBuf);
+      if (pcBuf==NULL) { return CLPERR(psHdl,CLPERR_MEM,"Allocation of buffer in size %d for environment variable replacement failed",(int)szBuf); }
+      pcNew=pcBuf+(szBuf-(szPre+szEnv+szRst));
+      memcpy(pcNew,pcRow,szPre);
+      memcpy(pcNew+szPre,pcEnv,szEnv);
+      memcpy(pcNew+szPre+szEnv,pcEnd,szRst);
+      SAFE_FREE(psHdl->apBuf[psHdl->siBuf]);
+      psHdl->apBuf[psHdl->siBuf]=pcBuf;
+      psHdl->pzBuf[psHdl->siBuf]=szBuf;
+      if (psStm!=NULL) { psStm->pcEnd=pcNew+szPre+szEnv+szRst-1; }
+   }
+   if (psStm!=NULL && psStm->pcRcl!=NULL) {
+      psStm->pcRcl=(psStm->pcRcl==psHdl->pcRow && pcRow==psHdl->pcRow)?pcNew:NULL;
+   }
+   if (psHdl->pcInp!=NULL) { psHdl->szInp+=pcRow-psHdl->pcInp; }
+   psHdl->pcInp=pcNew;
+   psHdl->pcRow=pcNew;
+   psHdl->pcOld=pcNew+szPre;
+   (*ppCur)=pcNew+szPre;
+   TRACE(pfTrc,"%s %s\n",fpcPre(psHdl,0),psHdl->pcInp);
+   if (psStm!=NULL && ppCur==&psHdl->pcCur) {
+      return(siClpStmFil(psHdl));
+   }
+   return(CLP_OK);
 }
 
 static int siClpScnNat(
@@ -4544,7 +6757,9 @@ static int siClpScnNat(
    int                           isEnv=psHdl->isEnv;
    const char*                   pcEnv=NULL;
    const char*                   pcOld=NULL;
+   const char*                   pcBeg=NULL;
    char*                         pcZro=NULL;
+   int                           isEsc=FALSE;
    time_t                        t;
    struct tm                     tm;
    struct tm                     stAkt;
@@ -4564,30 +6779,17 @@ static int siClpScnNat(
          TRACE(pfTrc,"SCANNER-TOKEN(END)-LEXEME(%s)\n",isPrnLex(psArg,pcHlp));
          return(CLPTOK_END);
       } else if (isSeparation(*(*ppCur))) { /*separation*/
-         if (piSep!=NULL) { *piSep=(unsigned char)(*(*ppCur)); }
-         if (*(*ppCur)=='\n') {
-            psHdl->siRow++;
-            psHdl->pcRow=(*ppCur)+1;
-         }
-         (*ppCur)++;
+         (*ppCur)=pcClpSkpSep((*ppCur),piSep,&psHdl->siRow,&psHdl->pcRow);
          psHdl->pcOld=(*ppCur);
       } else if (*(*ppCur)==C_HSH) { /*comment*/
-         (*ppCur)++;
-         while (*(*ppCur)!=C_HSH && *(*ppCur)!=EOS) {
-            if (*(*ppCur)=='\n') {
-               psHdl->siRow++;
-               psHdl->pcRow=(*ppCur)+1;
-            }
-            (*ppCur)++;
-         }
+         (*ppCur)=pcClpSkpChr((*ppCur)+1,C_HSH,&psHdl->siRow,&psHdl->pcRow);
          if (*(*ppCur)!=C_HSH) {
             return CLPERR(psHdl,CLPERR_LEX,"Comment not terminated with '%c'",C_HSH);
          }
          (*ppCur)++;
          psHdl->pcOld=(*ppCur);
       } else if (*(*ppCur)==';') { /*line comment*/
-         (*ppCur)++;
-         while (*(*ppCur)!='\n' && *(*ppCur)!=EOS) { (*ppCur)++; }
+         (*ppCur)=pcClpSkpChr((*ppCur)+1,'\n',NULL,NULL);
          if (*(*ppCur)=='\n') {
             (*ppCur)++;
             psHdl->siRow++;
@@ -4595,6 +6797,7 @@ static int siClpScnNat(
          }
          psHdl->pcOld=(*ppCur);
       } else if (isEnv && *(*ppCur)=='<') { /*environment variable replacement*/
+         pcBeg=(*ppCur);
          (*ppCur)++;
          while ((*ppCur)[0]!=EOS && (*ppCur)[0]!='>') {
             LEX_REALLOC;
@@ -4608,18 +6811,11 @@ static int siClpScnNat(
          (*ppCur)++;
          pcLex=(*ppLex);
          pcEnv=getenvar(pcLex,0,sizeof(acHlp),acHlp);
+         psHdl->uiDyn++;
          if (pcEnv!=NULL) {
-            size_t l=pcCur-psHdl->pcInp;
-            if (psHdl->siBuf>=CLPMAX_BUFCNT) {
-               return CLPERR(psHdl,CLPERR_LEX,"Environment variable replacement (%s=%s) not possible (more than %d replacements)",pcLex,pcEnv,CLPMAX_BUFCNT);
-            }
-            srprintf(&psHdl->apBuf[psHdl->siBuf],&psHdl->pzBuf[psHdl->siBuf],l+strlen(pcEnv)+strlen((*ppCur)),"%.*s%s%s",(int)l,psHdl->pcInp,pcEnv,(*ppCur));
-            TRACE(pfTrc,"SCANNER-ENVARREP\n%s %s\n%s %s\n",fpcPre(psHdl,0),psHdl->pcInp,fpcPre(psHdl,0),psHdl->apBuf[psHdl->siBuf]);
-            (*ppCur)=psHdl->apBuf[psHdl->siBuf]+l;
-            psHdl->pcInp=psHdl->apBuf[psHdl->siBuf];
-            psHdl->pcOld=psHdl->apBuf[psHdl->siBuf]+(psHdl->pcOld-psHdl->pcInp);
-            psHdl->pcRow=psHdl->apBuf[psHdl->siBuf]+(psHdl->pcRow-psHdl->pcInp);
-            psHdl->siBuf++;
+            int siErr=siClpEnvRep(psHdl,pfTrc,pcBeg,(*ppCur),pcEnv,ppCur);
+            if (siErr<0) { return(siErr); }
+            pcCur=(*ppCur);
             isEnv=TRUE;
          } else {
             isEnv=FALSE;
@@ -4630,19 +6826,10 @@ static int siClpScnNat(
          *pcLex= 'd'; pcLex++;
          *pcLex='\''; pcLex++;
          (*ppCur)++;
-         while ((*ppCur)[0]!=EOS && ((*ppCur)[0]!=USECHR || (*ppCur)[1]==USECHR)) {
-            LEX_REALLOC;
-            *pcLex=*(*ppCur); pcLex++;
-            if (*(*ppCur)=='\n') {
-               (*ppCur)++;
-               psHdl->siRow++;
-               psHdl->pcRow=(*ppCur);
-            } else if ((*ppCur)[0]==USECHR) {
-               (*ppCur)+=2;
-            } else {
-               (*ppCur)++;
-            }
-         }
+         pcBeg=(*ppCur);
+         (*ppCur)=pcClpStrEnd(psHdl,pcBeg,USECHR,&isEsc);
+         LEX_RESERVE((*ppCur)-pcBeg);
+         pcLex=pcClpLexCpy(pcLex,pcBeg,(*ppCur),(isEsc)?USECHR:EOS);
          *pcLex=EOS;
          if (*(*ppCur)!=USECHR) {
             return CLPERR(psHdl,CLPERR_LEX,"String literal not terminated with '%c'",USECHR);
@@ -4657,19 +6844,10 @@ static int siClpScnNat(
          *pcLex=tolower(*(*ppCur)); pcLex++;
          *pcLex='\''; pcLex++;
          (*ppCur)+=2;
-         while ((*ppCur)[0]!=EOS && ((*ppCur)[0]!=USECHR || (*ppCur)[1]==USECHR)) {
-            LEX_REALLOC;
-            *pcLex=*(*ppCur); pcLex++;
-            if (*(*ppCur)=='\n') {
-               (*ppCur)++;
-               psHdl->siRow++;
-               psHdl->pcRow=(*ppCur);
-            } else if ((*ppCur)[0]==USECHR) {
-               (*ppCur)+=2;
-            } else {
-               (*ppCur)++;
-            }
-         }
+         pcBeg=(*ppCur);
+         (*ppCur)=pcClpStrEnd(psHdl,pcBeg,USECHR,&isEsc);
+         LEX_RESERVE((*ppCur)-pcBeg);
+         pcLex=pcClpLexCpy(pcLex,pcBeg,(*ppCur),(isEsc)?USECHR:EOS);
          *pcLex=EOS;
          if (*(*ppCur)!=USECHR) {
             return CLPERR(psHdl,CLPERR_LEX,"String literal not terminated with '%c'",USECHR);
@@ -4681,17 +6859,17 @@ static int siClpScnNat(
          while ((*ppCur)[0]=='-') {
             (*ppCur)++;
          }
-         *pcLex=*(*ppCur);
-         (*ppCur)++; pcLex++;
+         pcBeg=(*ppCur);
+         (*ppCur)++;
          while (isCst(*(*ppCur))) {
-            LEX_REALLOC;
             if (!isKyw(*(*ppCur)) && pcOld==NULL) {
                pcOld=(*ppCur);
-               pcZro=pcLex;
             }
-            *pcLex=*(*ppCur);
-            (*ppCur)++; pcLex++;
+            (*ppCur)++;
          }
+         LEX_RESERVE((*ppCur)-pcBeg);
+         if (pcOld!=NULL) { pcZro=pcLex+(pcOld-pcBeg); }
+         pcLex=pcClpLexCpy(pcLex,pcBeg,(*ppCur),EOS);
          *pcLex=EOS;
          // cppcheck-suppress objectIndex
          if(pcCur[0]=='-' && pcCur[1]!='-' && psArg!=NULL && psArg->psFix->siTyp==siTyp && isClpKywTyp(psHdl,pfErr,pfTrc,pcHlp,psArg)) {
@@ -4724,13 +6902,13 @@ static int siClpScnNat(
          *pcLex='d'; pcLex++;
          *pcLex='\''; pcLex++;
          if (psArg!=NULL && isalpha(*(*ppCur))) {
-            *pcLex=*(*ppCur);
-            (*ppCur)++; pcLex++;
+            pcBeg=(*ppCur);
+            (*ppCur)++;
             while (isCst(*(*ppCur))) {
-               LEX_REALLOC;
-               *pcLex=*(*ppCur);
-               (*ppCur)++; pcLex++;
+               (*ppCur)++;
             }
+            LEX_RESERVE((*ppCur)-pcBeg);
+            pcLex=pcClpLexCpy(pcLex,pcBeg,(*ppCur),EOS);
             *pcLex=EOS;
             if (isReqStrOpr3(*(*ppCur)) || isSeparation(*(*ppCur))) {
                if (isClpKywStr(psHdl,pfErr,pfTrc,(*ppLex)+2,psArg,ppVal,*(*ppCur))) {
@@ -4745,6 +6923,7 @@ static int siClpScnNat(
                }
             }
          }
+         pcBeg=(*ppCur);
          while ((*ppCur)[0]!=EOS && isStr((*ppCur)[0]) && !isSeparation((*ppCur)[0]) && !isReqStrOpr2((*ppCur)[0]) &&
                 (siRbc>0 || (*ppCur)[0]!=')') && (siSbc>0 || (*ppCur)[0]!=C_SBC) && (siCbc>0 || (*ppCur)[0]!=C_CBC)) {
             if ((*ppCur)[0]=='(') {
@@ -4760,25 +6939,25 @@ static int siClpScnNat(
             } else if ((*ppCur)[0]==C_CBC) {
                siCbc--;
             }
-            LEX_REALLOC;
-            *pcLex=*(*ppCur);
-            pcLex++; (*ppCur)++;
+            (*ppCur)++;
          }
+         LEX_RESERVE((*ppCur)-pcBeg);
+         pcLex=pcClpLexCpy(pcLex,pcBeg,(*ppCur),EOS);
          *pcLex=EOS;
          TRACE(pfTrc,"SCANNER-TOKEN(STR)-LEXEME(%s)-REQUIRED\n",isPrnLex(psArg,pcHlp));
          return(CLPTOK_STR);
       } else if (isalpha((*ppCur)[0])) { /*simple keyword*/
-         *pcLex=*(*ppCur);
-         (*ppCur)++; pcLex++;
+         pcBeg=(*ppCur);
+         (*ppCur)++;
          while (isCst(*(*ppCur))) {
-            LEX_REALLOC;
             if (!isKyw(*(*ppCur)) && pcOld==NULL) {
                pcOld=(*ppCur);
-               pcZro=pcLex;
             }
-            *pcLex=*(*ppCur);
-            (*ppCur)++; pcLex++;
+            (*ppCur)++;
          }
+         LEX_RESERVE((*ppCur)-pcBeg);
+         if (pcOld!=NULL) { pcZro=pcLex+(pcOld-pcBeg); }
+         pcLex=pcClpLexCpy(pcLex,pcBeg,(*ppCur),EOS);
          *pcLex=EOS;
          if (pcOld!=NULL && !isClpKywVal(psHdl,pfErr,pfTrc,pcHlp,psArg,ppVal)) {
             if (pcZro!=NULL) *pcZro=0x00;
@@ -4871,6 +7050,7 @@ static int siClpScnNat(
                }
             }
             if (pcHlp[1]=='+') {
+               psHdl->uiDyn++;
                t=time(NULL);
                if (t==-1) {
                   return CLPERR(psHdl,CLPERR_SYS,"Determine the current time is not possible%s","");
@@ -4888,6 +7068,7 @@ static int siClpScnNat(
                                                  tmAkt->tm_year+1900,tmAkt->tm_mon+1,tmAkt->tm_mday,tmAkt->tm_hour,tmAkt->tm_min,tmAkt->tm_sec);
                }
             } else if (pcHlp[1]=='-') {
+               psHdl->uiDyn++;
                t=time(NULL);
                if (t==-1) {
                   return CLPERR(psHdl,CLPERR_SYS,"Determine the current time is not possible%s","");
@@ -4928,7 +7109,7 @@ static int siClpScnNat(
                                               tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,tm.tm_sec);
             }
             TRACE(pfTrc,"SCANNER-TOKEN(NUM)-LEXEME(%s)-TIME\n",isPrnLex(psArg,pcHlp));
-            if (psArg!=NULL) { psArg->psStd->uiFlg|=CLPFLG_TIM; }
+            if (psArg!=NULL) { vdClpDflSet(psHdl,psArg,CLPFLG_TIM); }
             return(CLPTOK_NUM);
          } else {
             while (isdigit(*(*ppCur))) {
@@ -5081,6 +7262,10 @@ static int siClpScnSrc(
    const TsSym*                  psArg)
 {
    psHdl->pcOld=psHdl->pcCur;
+   if (psHdl->psStm!=NULL) {
+      int siErr=siClpStmFil(psHdl);
+      if (siErr<0) { return(siErr); }
+   }
    return(siClpScnNat(psHdl,psHdl->pfErr,psHdl->pfScn,&psHdl->pcCur,&psHdl->szLex,&psHdl->pcLex,siTyp,psArg,&psHdl->isSep,&psHdl->psVal));
 }
 
@@ -5190,13 +7375,15 @@ static int siClpPrsPar(
       strlcpy(acKyw,psHdl->pcLex,sizeof(acKyw));
       siErr=siClpSymFnd(psHdl,siLev,acKyw,psTab,&psArg,NULL);
       if (siErr<0) { return(siErr); }
-      siErr=siClpBldLnk(psHdl,siLev,siPos,(psHdl->pcOld-psHdl->pcInp),psArg->psFix->psInd,TRUE);
+      siErr=siClpBldLnk(psHdl,siLev,siPos,(psHdl->pcOld-psHdl->pcInp)+psHdl->szInp,psArg->psFix->psInd,TRUE);
       if (siErr<0) { return(siErr); }
       if (piOid!=NULL) { *piOid=psArg->psFix->siOid; }
       if (isOvl) { // stop parsing if object id for main overlay known
          psHdl->siTok=CLPTOK_END;
          return(CLP_OK);
       }
+      siErr=siExtentConTab(psHdl,siLev,psArg);
+      if (siErr<0) { return(siErr); }
       psHdl->siTok=siClpScnSrc(psHdl,0,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
       if (psHdl->siTok==CLPTOK_SGN) {
@@ -5309,7 +7496,7 @@ static int siClpAcpFil(
    if (psHdl->siTok!=CLPTOK_STR) {
       return CLPERR(psHdl,CLPERR_SYN,"After object/overlay/array assignment '%s.%s=' parameter file ('filename') expected",pcPat,psArg->psStd->pcKyw);
    }
-   srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnLex2(psArg,psHdl->pcLex)),"%s.%s=%s\n",pcPat,GETKYW(psArg),isPrnLex2(psArg,psHdl->pcLex));
+   srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnLex2(psArg,psHdl->pcLex)),"%s.%s=%s\n",pcPat,GETKYW(psArg),isPrnLex2(psArg,psHdl->pcLex));
    psHdl->siTok=siClpScnSrc(psHdl,0,psArg);
    if (psHdl->siTok<0) { return(psHdl->siTok); }
    return(CLP_OK);
@@ -5324,11 +7511,13 @@ static int siClpPrsFil(
 {
    char                          acSrc[strlen(psHdl->pcSrc)+1];
    char*                         pcPar=NULL;
+   FILE*                         pfFil=NULL;
    int                           siRow,siCnt,siErr,siSiz=0;
    const char*                   pcCur;
    const char*                   pcInp;
    const char*                   pcOld;
    const char*                   pcRow;
+   size_t                        szInp;
    char                          acMsg[1024]="";
 
    TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d PARFIL(%s=val)\n",fpcPre(psHdl,siLev),siLev,siPos,psArg->psStd->pcKyw);
@@ -5340,7 +7529,17 @@ static int siClpPrsFil(
 
    char acFil[strlen(psHdl->pcLex)];
    strcpy(acFil,psHdl->pcLex+2);
-   siErr=psHdl->pfF2s(psHdl->pvGbl,psHdl->pvF2s,acFil,&pcPar,&siSiz,acMsg,sizeof(acMsg));
+   if (psHdl->pfF2s==siOwnFile2String) {
+      errno=0;
+      char* pcFil=dcpmapfil(acFil);
+      if (pcFil==NULL) {
+         return CLPERR(psHdl,CLPERR_SYS,"Parameter file: Mapping of file name '%s' failed (%d - %s)",acFil,errno,pcSysError(errno));
+      }
+      siErr=file2stm(psHdl->pvF2s,pcFil,&pfFil,acMsg,sizeof(acMsg));
+      free(pcFil);
+   } else {
+      siErr=psHdl->pfF2s(psHdl->pvGbl,psHdl->pvF2s,acFil,&pcPar,&siSiz,acMsg,sizeof(acMsg));
+   }
    if (siErr<0) {
       siErr=CLPERR(psHdl,CLPERR_SYS,"Parameter file: %s",acMsg);
       SAFE_FREE(pcPar);
@@ -5351,17 +7550,28 @@ static int siClpPrsFil(
    strcpy(acSrc,psHdl->pcSrc);
    srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(CLPSRC_PAF)+strlen(acFil),"%s%s",CLPSRC_PAF,acFil);
 
-   pcInp=psHdl->pcInp; psHdl->pcInp=pcClpUnEscape(psHdl,pcPar);
-   SAFE_FREE(pcPar);
-   if (psHdl->pcInp==NULL) {
-      siErr=CLPERR(psHdl,CLPERR_MEM,"Un-escaping of parameter file (%s) failed",acFil);
-      return(siErr);
+   pcInp=psHdl->pcInp;
+   pcCur=psHdl->pcCur;
+   pcOld=psHdl->pcOld;
+   pcRow=psHdl->pcRow;
+   if (pfFil!=NULL) {
+      psHdl->siBuf++;
+      siErr=siClpStmOpn(psHdl,pfFil);
+      if (siErr<0) { return(siErr); }
+   } else {
+      psHdl->pcInp=pcClpUnEscape(psHdl,(pcPar!=NULL)?pcPar:"",TRUE);
+      SAFE_FREE(pcPar);
+      if (psHdl->pcInp==NULL) {
+         siErr=CLPERR(psHdl,CLPERR_MEM,"Un-escaping of parameter file (%s) failed",acFil);
+         return(siErr);
+      }
+      psHdl->pcCur=psHdl->pcInp;
+      psHdl->pcOld=psHdl->pcInp;
+      psHdl->pcRow=psHdl->pcInp;
+      psHdl->siBuf++;
    }
-   pcCur=psHdl->pcCur; psHdl->pcCur=psHdl->pcInp;
-   pcOld=psHdl->pcOld; psHdl->pcOld=psHdl->pcInp;
-   pcRow=psHdl->pcRow; psHdl->pcRow=psHdl->pcInp;
    siRow=psHdl->siRow; psHdl->siRow=1;
-   psHdl->siBuf++;
+   szInp=psHdl->szInp; psHdl->szInp=0;
    psHdl->siTok=siClpScnSrc(psHdl,psArg->psFix->siTyp,psArg);
    if (psHdl->siTok<0) { return(psHdl->siTok); }
    if (isAry) {
@@ -5412,10 +7622,11 @@ static int siClpPrsFil(
       }
    }
    if (psHdl->siTok==CLPTOK_END) {
+      if (psClpStmAct(psHdl)!=NULL) { vdClpStmFre(psHdl,FALSE); }
       psHdl->siBuf--;
       psHdl->pcLex[0]=EOS;
       strcpy(psHdl->pcSrc,acSrc);
-      psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow;
+      psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow; psHdl->szInp=szInp;
       TRACE(psHdl->pfPrs,"PARAMETER-FILE-PARSER-END(FILE=%s CNT=%d)\n",acFil,siCnt);
       psHdl->siTok=siClpScnSrc(psHdl,0,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
@@ -5433,14 +7644,14 @@ static int siClpPrsObjWob(
 {
    int                           siErr,siCnt;
    TsSym*                        psDep=NULL;
-   TsVar                         asSav[CLPMAX_TABCNT];
+   int                           siSav=0;
 
    TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d OBJ(%s(parlst))-OPN)\n",fpcPre(psHdl,siLev),siLev,siPos,psArg->psStd->pcKyw);
-   siErr=siClpIniObj(psHdl,siLev,siPos,psArg,&psDep,asSav);
+   siErr=siClpIniObj(psHdl,siLev,siPos,psArg,&psDep,&siSav);
    if (siErr<0) { return(siErr); }
    siCnt=siClpPrsParLst(psHdl,siLev+1,psDep);
    if (siCnt<0) { return(siCnt); }
-   siErr=siClpFinObj(psHdl,siLev,siPos,psArg,psDep,asSav);
+   siErr=siClpFinObj(psHdl,siLev,siPos,psArg,psDep,siSav);
    if (siErr<0) { return(siErr); }
    return(siCnt);
 }
@@ -5480,13 +7691,13 @@ static int siClpPrsOvl(
 {
    int                           siErr,siCnt,siOid=0;
    TsSym*                        psDep=NULL;
-   TsVar                         asSav[CLPMAX_TABCNT];
+   int                           siSav=0;
    TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d OVL(%s.par)\n",fpcPre(psHdl,siLev),siLev,siPos,psArg->psStd->pcKyw);
-   siErr=siClpIniOvl(psHdl,siLev,siPos,psArg,&psDep,asSav);
+   siErr=siClpIniOvl(psHdl,siLev,siPos,psArg,&psDep,&siSav);
    if (siErr<0) { return(siErr); }
    siCnt=siClpPrsPar(psHdl,siLev+1,siPos,psDep,FALSE,&siOid);
    if (siCnt<0) { return(siCnt); }
-   siErr=siClpFinOvl(psHdl,siLev,siPos,psArg,psDep,asSav,siOid);
+   siErr=siClpFinOvl(psHdl,siLev,siPos,psArg,psDep,siSav,siOid);
    if (siErr<0) { return(siErr); }
    return(CLP_OK);
 }
@@ -5498,25 +7709,25 @@ static int siClpPrsMain(
    int*                          piOid)
 {
    int                           siErr,siOid;
-   TsVar                         asSav[CLPMAX_TABCNT];
+   int                           siSav=0;
    if (psHdl->isOvl) {
       TRACE(psHdl->pfPrs,"%s PARSER(OVL(MAIN.par)\n",fpcPre(psHdl,0));
       if (psHdl->siTok==CLPTOK_DOT) {
          psHdl->siTok=siClpScnSrc(psHdl,0,NULL);
          if (psHdl->siTok<0) { return(psHdl->siTok); }
       }
-      siErr=siClpIniMainOvl(psHdl,psTab,asSav);
+      siErr=siClpIniMainOvl(psHdl,psTab,&siSav);
       if (siErr<0) { return(siErr); }
       siErr=siClpPrsPar(psHdl,0,0,psTab,isOvl,&siOid);
       if (siErr<0) { return(siErr); }
-      siErr=siClpFinMainOvl(psHdl,psTab,asSav,siOid);
+      siErr=siClpFinMainOvl(psHdl,psTab,siSav,siOid);
       if (siErr<0) { return(siErr); }
       if (piOid!=NULL) { (*piOid)=siOid; }
       return(1);
    } else {
       int siCnt;
       TRACE(psHdl->pfPrs,"%s PARSER(OBJ(MAIN(parlst)-OPN)\n",fpcPre(psHdl,0));
-      siErr=siClpIniMainObj(psHdl,psTab,asSav);
+      siErr=siClpIniMainObj(psHdl,psTab,&siSav);
       if (siErr<0) { return(siErr); }
       if (psHdl->siTok==CLPTOK_RBO) {
          psHdl->siTok=siClpScnSrc(psHdl,0,NULL);
@@ -5537,7 +7748,7 @@ static int siClpPrsMain(
          siCnt=siClpPrsParLst(psHdl,0,psTab);
          if (siCnt<0) { return(siCnt); }
       }
-      siErr=siClpFinMainObj(psHdl,psTab,asSav);
+      siErr=siClpFinMainObj(psHdl,psTab,siSav);
       if (siErr<0) { return(siErr); }
       TRACE(psHdl->pfPrs,"%s PARSER(OBJ(MAIN(parlst))-CLS)\n",fpcPre(psHdl,0));
       return(siCnt);
@@ -5653,6 +7864,147 @@ static int siClpPrsOvlLst(
 }
 /**********************************************************************/
 
+/* Number literals are converted in one pass by accumulating the digits of the base with overflow checks.
+ * The bases 'b', 'o' and 'x' are unsigned 64 bit values (a minus sign negates the value), 'd' and 't'
+ * are signed 64 bit values. The end pointer is set behind the last digit or to the start if no digit found.*/
+static int siClpNumAcc(
+   const char*                   pcStr,
+   const int                     siBas,
+   const int                     isSgn,
+   I64*                          piVal,
+   const char**                  ppEnd)
+{
+   const char*                   p=pcStr;
+   const char*                   b;
+   U64                           uiLim;
+   U64                           uiVal=0;
+   unsigned int                  d;
+   int                           isNeg=FALSE;
+   int                           isOvf=FALSE;
+
+   if (*p=='+' || *p=='-') {
+      isNeg=(*p=='-');
+      p++;
+   }
+   uiLim=(isSgn)?((isNeg)?((U64)1)<<63:(((U64)1)<<63)-1):ULLONG_MAX;
+   b=p;
+   while (1) {
+      if (*p>='0' && *p<='9') {
+         d=*p-'0';
+      } else if (*p>='a' && *p<='f') {
+         d=*p-'a'+10;
+      } else if (*p>='A' && *p<='F') {
+         d=*p-'A'+10;
+      } else {
+         break;
+      }
+      if (d>=(unsigned int)siBas) break;
+      if (uiVal>(uiLim-d)/siBas) {
+         isOvf=TRUE;
+      } else {
+         uiVal=uiVal*siBas+d;
+      }
+      p++;
+   }
+   if (p==b) {
+      (*ppEnd)=pcStr;
+      (*piVal)=0;
+      return(CLP_OK);
+   }
+   (*ppEnd)=p;
+   if (isOvf) {
+      return(ERANGE);
+   }
+   (*piVal)=(isNeg)?(I64)(0-uiVal):(I64)uiVal;
+   return(CLP_OK);
+}
+
+/* Floating point literals are converted independent of the locale ('.' or ',' as decimal point). With up to
+ * 19 significant digits resulting in an exact mantissa and a power of ten up to 22 the value is calculated
+ * exactly (one rounding like strtod()), else strtod() is used for the digits with an exponent but without
+ * decimal point. Literals without digits (inf, nan) are also given to strtod().*/
+static int siClpFltAcc(
+   const char*                   pcStr,
+   double*                       pfVal,
+   const char**                  ppEnd)
+{
+   static const double           afPow[]={1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,
+                                          1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,1e22};
+   const char*                   p=pcStr;
+   const char*                   pcDig;
+   const char*                   pcDot=NULL;
+   const char*                   pcEnd;
+   char                          acBuf[128];
+   char*                         pcBuf=acBuf;
+   char*                         q;
+   U64                           uiMan=0;
+   int                           siSig=0;
+   int                           siExp=0;
+   int                           siPow=0;
+   int                           isNeg=FALSE;
+   int                           isTrc=FALSE;
+   int                           siErr=CLP_OK;
+   double                        d;
+
+   if (*p=='+' || *p=='-') {
+      isNeg=(*p=='-');
+      p++;
+   }
+   pcDig=p;
+   while (isdigit(*p) || (pcDot==NULL && (*p=='.' || *p==','))) {
+      if (*p=='.' || *p==',') {
+         pcDot=p;
+      } else if (siSig<19) {
+         uiMan=uiMan*10+(*p-'0');
+         if (uiMan) siSig++;
+         if (pcDot!=NULL) siExp--;
+      } else {
+         isTrc=TRUE;
+         if (pcDot==NULL) siExp++;
+      }
+      p++;
+   }
+   if (p==pcDig || (p-pcDig==1 && pcDot!=NULL)) {
+      errno=0;
+      (*pfVal)=strtod(pcStr,(char**)ppEnd);
+      return((errno==ERANGE && (*pfVal)==HUGE_VAL)?ERANGE:CLP_OK);
+   }
+   pcEnd=p;
+   if ((*p=='e' || *p=='E') && (isdigit(p[1]) || ((p[1]=='+' || p[1]=='-') && isdigit(p[2])))) {
+      int isNgx=(p[1]=='-');
+      p+=(isdigit(p[1]))?1:2;
+      while (isdigit(*p)) {
+         if (siPow<100000) siPow=siPow*10+(*p-'0');
+         p++;
+      }
+      if (isNgx) siPow=-siPow;
+   }
+   (*ppEnd)=p;
+   siExp+=siPow;
+   if (uiMan==0 && !isTrc) {
+      d=0.0;
+   } else if (!isTrc && uiMan<=(((U64)1)<<53) && siExp>=-22 && siExp<=22) {
+      d=(siExp<0)?(double)uiMan/afPow[-siExp]:(double)uiMan*afPow[siExp];
+   } else {
+      size_t   s=(pcEnd-pcDig)+16;
+      if (s>sizeof(acBuf)) {
+         pcBuf=(char*)malloc(s);
+         if (pcBuf==NULL) return(ENOMEM);
+      }
+      q=pcBuf;
+      for (p=pcDig;p<pcEnd;p++) {
+         if (isdigit(*p)) *q++=*p;
+      }
+      sprintf(q,"e%d",siPow-((pcDot!=NULL)?(int)(pcEnd-pcDot-1):0));
+      errno=0;
+      d=strtod(pcBuf,NULL);
+      if (errno==ERANGE && d==HUGE_VAL && !isNeg) siErr=ERANGE;
+      if (pcBuf!=acBuf) free(pcBuf);
+   }
+   (*pfVal)=(isNeg)?-d:d;
+   return(siErr);
+}
+
 static int siFromNumberLexeme(
    TsHdl*                        psHdl,
    const int                     siLev,
@@ -5660,58 +8012,23 @@ static int siFromNumberLexeme(
    const char*                   pcVal,
    I64*                          piVal)
 {
-   char*                         pcHlp=NULL;
+   const char*                   pcHlp=NULL;
+   int                           siErr;
 
    switch (pcVal[0]) {
-   case 'b': {
-      errno=0;
-      unsigned long long int l=strtoull(pcVal+1,&pcHlp, 2);
-      if ((l==ULLONG_MAX && errno==ERANGE)) {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      }
-      (*piVal)=l;
-   } break;
-   case 'o': {
-      errno=0;
-      unsigned long long int l=strtoull(pcVal+1,&pcHlp, 8);
-      if ((l==ULLONG_MAX && errno==ERANGE)) {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      }
-      (*piVal)=l;
-   } break;
-   case 'd': {
-      errno=0;
-      long long int l=strtoll(pcVal+1,&pcHlp,10);
-      if ((l==LLONG_MIN || l==LLONG_MAX) && errno==ERANGE) {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      }
-      (*piVal)=l;
-   } break;
-   case 'x': {
-      errno=0;
-      unsigned long long int l=strtoull(pcVal+1,&pcHlp,16);
-      if ((l==ULLONG_MAX && errno==ERANGE)) {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      }
-      (*piVal)=l;
-   } break;
-   case 't': {
-      errno=0;
-      long long int l=strtoll(pcVal+1,&pcHlp,10);
-      if ((l==LLONG_MIN || l==LLONG_MAX) && errno==ERANGE) {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      }
-      (*piVal)=l;
-   } break;
+   case 'b': siErr=siClpNumAcc(pcVal+1, 2,FALSE,piVal,&pcHlp); break;
+   case 'o': siErr=siClpNumAcc(pcVal+1, 8,FALSE,piVal,&pcHlp); break;
+   case 'd': siErr=siClpNumAcc(pcVal+1,10,TRUE ,piVal,&pcHlp); break;
+   case 'x': siErr=siClpNumAcc(pcVal+1,16,FALSE,piVal,&pcHlp); break;
+   case 't': siErr=siClpNumAcc(pcVal+1,10,TRUE ,piVal,&pcHlp); break;
    default:
       return CLPERR(psHdl,CLPERR_SEM,"Base (%c(0x%02X)) of number literal (%s.%s=%s) not supported",pcVal[0],pcVal[0],fpcPat(psHdl,siLev),psArg->psStd->pcKyw,isPrnStr(psArg,pcVal+1));
    }
-   if (pcHlp==NULL || pcHlp[0]) {
-      if (pcHlp==NULL) {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (end pointer is NULL)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      } else {
-         return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (rest: %s)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,isPrnStr(psArg,pcHlp));
-      }
+   if (siErr) {
+      return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
+   }
+   if (pcHlp[0]) {
+      return CLPERR(psHdl,CLPERR_SEM,"Number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (rest: %s)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,isPrnStr(psArg,pcHlp));
    }
    return(CLP_OK);
 }
@@ -5723,35 +8040,20 @@ static int siFromFloatLexeme(
    const char*                   pcVal,
    double*                       pfVal)
 {
-   char*                         pcHlp=NULL;
+   const char*                   pcHlp=NULL;
+   int                           siErr;
 
    switch (pcVal[0]) {
-   case 'd': {
-      errno=0;
-      double d=strtod(pcVal+1,&pcHlp);
-      if (d==HUGE_VAL && errno==ERANGE) {
-         return CLPERR(psHdl,CLPERR_SEM,"Floating number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      }
-      if (pcHlp!=NULL && *pcHlp=='.') {
-         char* p=pcHlp;
-         *p=',';
-         errno=0;
-         d=strtod(pcVal+1,&pcHlp);
-         if (d==HUGE_VAL && errno==ERANGE) {
-            return CLPERR(psHdl,CLPERR_SEM,"Floating number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-         }
-         *p='.';
-      }
-      *pfVal=d;
-   } break;
+   case 'd': siErr=siClpFltAcc(pcVal+1,pfVal,&pcHlp); break;
    default: return CLPERR(psHdl,CLPERR_SEM,"Base (%c(0x%02X)) of floating point literal (%s.%s=%s) not supported",pcVal[0],pcVal[0],fpcPat(psHdl,siLev),psArg->psStd->pcKyw,isPrnStr(psArg,pcVal+1));
    }
-   if (pcHlp==NULL || pcHlp[0]) {
-      if (pcHlp==NULL) {
-         return CLPERR(psHdl,CLPERR_SEM,"Floating number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (end pointer is NULL)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
-      } else {
-         return CLPERR(psHdl,CLPERR_SEM,"Floating number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (rest: %s)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,isPrnStr(psArg,pcHlp));
-      }
+   if (siErr==ENOMEM) {
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to convert floating number (%s) of '%s.%s' failed",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
+   } else if (siErr) {
+      return CLPERR(psHdl,CLPERR_SEM,"Floating number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (limits achieved)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
+   }
+   if (pcHlp[0]) {
+      return CLPERR(psHdl,CLPERR_SEM,"Floating number (%s) of '%s.%s' cannot be converted to a valid 64 bit value (rest: %s)",isPrnStr(psArg,pcVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,isPrnStr(psArg,pcHlp));
    }
    return(CLP_OK);
 }
@@ -5765,6 +8067,16 @@ static int siClpPrsExp(
    size_t*                       pzVal,
    char**                        ppVal);
 
+static inline void vdClpLexSwp(TsHdl* psHdl, size_t* pzVal, char** ppVal)
+{
+   char*                         pcHlp=psHdl->pcLex;
+   size_t                        szHlp=psHdl->szLex;
+   psHdl->pcLex=(*ppVal);
+   psHdl->szLex=(*pzVal);
+   (*ppVal)=pcHlp;
+   (*pzVal)=szHlp;
+}
+
 static int siClpPrsFac(
    TsHdl*                        psHdl,
    const int                     siLev,
@@ -5780,12 +8092,11 @@ static int siClpPrsFac(
    I64                           siVal;
    F64                           flVal;
    void*                         pvDat;
-   char                          acLex[strlen(psHdl->pcLex)+1];
-   strcpy(acLex,psHdl->pcLex);
    switch(psHdl->siTok) {
    case CLPTOK_NUM:
    case CLPTOK_FLT:
    case CLPTOK_STR:
+      vdClpLexSwp(psHdl,pzVal,ppVal); // the lexeme becomes the value without copy
       psHdl->siTok=siClpScnSrc(psHdl,(isAry)?psArg->psFix->siTyp:0,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
       if (CLPISF_SEL(psArg->psStd->uiFlg)) {
@@ -5794,10 +8105,11 @@ static int siClpPrsFac(
          vdClpPrnArgTab(psHdl,psHdl->pfErr,1,psArg->psFix->siTyp,psArg->psDep);
          return(CLPERR_SEM);
       }
-      srprintf(ppVal,pzVal,strlen(acLex),"%s",acLex);
       TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d NUM/FLT/STR(%s))\n",fpcPre(psHdl,siLev),siLev,siPos,*ppVal);
       return(CLP_OK);
-   case CLPTOK_KYW:
+   case CLPTOK_KYW: {
+      char                       acLex[strlen(psHdl->pcLex)+1];
+      strcpy(acLex,psHdl->pcLex);
       siInd=0;
       if (siClpNxtOpr(psHdl->pcCur)==C_CBO) {
          psHdl->siTok=siClpScnSrc(psHdl,0,psArg);
@@ -5836,18 +8148,21 @@ static int siClpPrsFac(
             return CLPERR(psHdl,CLPERR_SEM,"The type (%s) of the symbol (%s) for argument '%s.%s' don't match the expected type (%s)",
                   pcMapClpTyp(psVal->psFix->siTyp),acLex,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
          }
-         if (psVal->psVar->pvDat==NULL || psVal->psVar->siCnt==0) {
+         if (GETVAR(psHdl,psVal)->pvDat==NULL || GETVAR(psHdl,psVal)->siCnt==0) {
             return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s) and type (%s) of variable value for argument (%s.%s) defined but data pointer not set (variable not yet defined)",
                   psVal->psStd->pcKyw,pcMapClpTyp(psVal->psFix->siTyp),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
          }
-         if (siInd<0 || siInd>=psVal->psVar->siCnt) {
+         if (siInd<0 || siInd>=GETVAR(psHdl,psVal)->siCnt) {
             return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s) and type (%s) of variable value for argument (%s.%s) defined but data element counter (%d) too small (index (%d) not valid)",
-                  psVal->psStd->pcKyw,pcMapClpTyp(psVal->psFix->siTyp),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psVal->psVar->siCnt,(int)siInd);
+                  psVal->psStd->pcKyw,pcMapClpTyp(psVal->psFix->siTyp),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,GETVAR(psHdl,psVal)->siCnt,(int)siInd);
+         }
+         if (!CLPISF_CON(psVal->psStd->uiFlg)) {
+            psHdl->uiDyn++;
          }
          if (CLPISF_DYN(psVal->psStd->uiFlg)) {
-            pvDat=(*((void**)psVal->psVar->pvDat));
+            pvDat=(*((void**)GETVAR(psHdl,psVal)->pvDat));
          } else {
-            pvDat=psVal->psVar->pvDat;
+            pvDat=GETVAR(psHdl,psVal)->pvDat;
          }
          switch (psVal->psFix->siTyp) {
          case CLPTYP_NUMBER:
@@ -5884,7 +8199,7 @@ static int siClpPrsFac(
          case CLPTYP_STRING:
             if (siInd>0) {
                char* pcDat=pvDat;
-               const char* pcEnd=pcDat+psVal->psVar->siLen;
+               const char* pcEnd=pcDat+GETVAR(psHdl,psVal)->siLen;
                if (CLPISF_FIX(psVal->psStd->uiFlg)) {
                   pcDat+=siInd*psVal->psFix->siSiz;
                } else {
@@ -5898,8 +8213,8 @@ static int siClpPrsFac(
                pvDat=pcDat;
             }
             if (CLPISF_BIN(psVal->psStd->uiFlg)) {
-               char acHlp[(2*psVal->psVar->siLen)+1];
-               int l=bin2hex((unsigned char*)pvDat,acHlp,psVal->psVar->siLen);
+               char acHlp[(2*GETVAR(psHdl,psVal)->siLen)+1];
+               int l=bin2hex((unsigned char*)pvDat,acHlp,GETVAR(psHdl,psVal)->siLen);
                acHlp[l]=0x00;
                srprintf(ppVal,pzVal,strlen(acHlp),"x'%s",acHlp);
             } else if (CLPISF_HEX(psVal->psStd->uiFlg)) {
@@ -5926,6 +8241,7 @@ static int siClpPrsFac(
          TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d KYW-CON(%s) FIX)\n",fpcPre(psHdl,siLev),siLev,siPos,*ppVal);
       }
       return(CLP_OK);
+   }
    case CLPTOK_RBO:
       if (CLPISF_SEL(psArg->psStd->uiFlg)) {
          CLPERR(psHdl,CLPERR_SEM,"The argument '%s.%s' requires one of the defined keywords as value",fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
@@ -5988,7 +8304,7 @@ static int siClpPrsTrm(
       }
       psHdl->siTok=siClpScnSrc(psHdl,psArg->psFix->siTyp,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
-      size_t szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+      size_t szVal=CLPINI_VALSIZ;
       char*  pcVal=(char*)calloc(1,szVal);
       if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
       siErr=siClpPrsTrm(psHdl,siLev,siPos,isAry,psArg,&szVal,&pcVal);
@@ -6037,7 +8353,7 @@ static int siClpPrsTrm(
       }
       psHdl->siTok=siClpScnSrc(psHdl,psArg->psFix->siTyp,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
-      size_t szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+      size_t szVal=CLPINI_VALSIZ;
       char*  pcVal=(char*)calloc(1,szVal);
       if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
       siErr=siClpPrsTrm(psHdl,siLev,siPos,isAry,psArg,&szVal,&pcVal);
@@ -6092,7 +8408,7 @@ static int siClpPrsTrm(
          vdClpPrnArgTab(psHdl,psHdl->pfErr,1,psArg->psFix->siTyp,psArg->psDep);
          return(CLPERR_SEM);
       }
-      size_t szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+      size_t szVal=CLPINI_VALSIZ;
       char*  pcVal=(char*)calloc(1,szVal);
       if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
       siErr=siClpPrsTrm(psHdl,siLev,siPos,isAry,psArg,&szVal,&pcVal);
@@ -6178,7 +8494,7 @@ static int siClpPrsExp(
       }
       psHdl->siTok=siClpScnSrc(psHdl,psArg->psFix->siTyp,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
-      size_t szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+      size_t szVal=CLPINI_VALSIZ;
       char*  pcVal=(char*)calloc(1,szVal);
       if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
       siErr=siClpPrsExp(psHdl,siLev,siPos,isAry,psArg,&szVal,&pcVal);
@@ -6247,7 +8563,7 @@ static int siClpPrsExp(
       }
       psHdl->siTok=siClpScnSrc(psHdl,psArg->psFix->siTyp,psArg);
       if (psHdl->siTok<0) { return(psHdl->siTok); }
-      size_t szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+      size_t szVal=CLPINI_VALSIZ;
       char*  pcVal=(char*)calloc(1,szVal);
       if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
       siErr=siClpPrsExp(psHdl,siLev,siPos,isAry,psArg,&szVal,&pcVal);
@@ -6294,7 +8610,7 @@ static int siClpPrsExp(
          vdClpPrnArgTab(psHdl,psHdl->pfErr,1,psArg->psFix->siTyp,psArg->psDep);
          return(CLPERR_SEM);
       }
-      size_t szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+      size_t szVal=CLPINI_VALSIZ;
       char*  pcVal=(char*)calloc(1,szVal);
       if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
       siErr=siClpPrsExp(psHdl,siLev,siPos,isAry,psArg,&szVal,&pcVal);
@@ -6366,7 +8682,7 @@ static int siClpPrsVal(
    TsSym*                        psArg)
 {
    int                           siInd;
-   size_t                        szVal=strlen(psHdl->pcLex)+CLPINI_VALSIZ;
+   size_t                        szVal=CLPINI_VALSIZ;
    char*                         pcVal=(char*)malloc(szVal);
    if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store expression values failed")); }
    psHdl->apPat[siLev]=psArg;
@@ -6496,21 +8812,22 @@ static int siClpBldPro(
       }
       if (psArg!=NULL) {
          if (CLPISF_ARG(psArg->psStd->uiFlg) || CLPISF_ALI(psArg->psStd->uiFlg)) {
-            C08* pcHlp=realloc_nowarn(psArg->psFix->pcPro,strlen(pcPro)+1);
+            C08* pcHlp=realloc_nowarn(OWNPRO(psHdl,psArg),strlen(pcPro)+1);
             if (pcHlp==NULL) {
                return CLPERR(psHdl,CLPERR_SIZ,"Build of property field failed (string (%d(%s)) too long)",(int)strlen(pcPro),pcPro);
             }
-            psArg->psFix->pcPro=pcHlp;
-            strcpy(psArg->psFix->pcPro,pcPro);
-            psArg->psFix->pcDft=psArg->psFix->pcPro;
-            pcHlp=realloc_nowarn(psArg->psFix->pcSrc,strlen(psHdl->pcSrc)+1);
+            GETPRO(psHdl,psArg)->pcPro=pcHlp;
+            strcpy(GETPRO(psHdl,psArg)->pcPro,pcPro);
+            GETPRO(psHdl,psArg)->pcDft=GETPRO(psHdl,psArg)->pcPro;
+            pcHlp=realloc_nowarn(OWNSRC(psHdl,psArg),strlen(psHdl->pcSrc)+1);
             if (pcHlp==NULL) {
                return CLPERR(psHdl,CLPERR_SIZ,"Build of source field failed (string (%d(%s)) too long)",(int)strlen(psHdl->pcSrc),psHdl->pcSrc);
             }
-            psArg->psFix->pcSrc=pcHlp;
-            strcpy(psArg->psFix->pcSrc,psHdl->pcSrc);
-            psArg->psFix->siRow=siRow;
-            srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(isPrnLex2(psArg,pcPro)),"%s=\"%s\"\n",pcPat,isPrnLex2(psArg,pcPro));
+            GETPRO(psHdl,psArg)->pcSrc=pcHlp;
+            strcpy(GETPRO(psHdl,psArg)->pcSrc,psHdl->pcSrc);
+            GETPRO(psHdl,psArg)->siRow=siRow;
+            vdClpDfcRst(psHdl,psArg);
+            srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(isPrnLex2(psArg,pcPro)),"%s=\"%s\"\n",pcPat,isPrnLex2(psArg,pcPro));
             TRACE(psHdl->pfBld,"BUILD-PROPERTY %s=\"%s\"\n",pcPat,isPrnStr(psArg,pcPro));
          } else {
             return CLPERR(psHdl,CLPERR_SEM,"Path '%s' for property \"%s\" is not an argument or alias",pcPat,isPrnStr(psArg,pcPro));
@@ -6539,35 +8856,35 @@ static int siClpBldLnk(
 
    if (psArg!=NULL) {
       if (isApp==FALSE) {
-         psArg->psVar->pvPtr=psArg->psVar->pvDat;
-         psArg->psVar->siCnt=0;
-         psArg->psVar->siLen=0;
-         psArg->psVar->siRst=(CLPISF_DYN(psArg->psStd->uiFlg))?0:psArg->psFix->siSiz;
-         if (CLPISF_FIX(psArg->psStd->uiFlg)) { psArg->psVar->siRst*=psArg->psFix->siMax; }
+         GETVAR(psHdl,psArg)->pvPtr=GETVAR(psHdl,psArg)->pvDat;
+         GETVAR(psHdl,psArg)->siCnt=0;
+         GETVAR(psHdl,psArg)->siLen=0;
+         GETVAR(psHdl,psArg)->siRst=(CLPISF_DYN(psArg->psStd->uiFlg))?0:psArg->psFix->siSiz;
+         if (CLPISF_FIX(psArg->psStd->uiFlg)) { GETVAR(psHdl,psArg)->siRst*=psArg->psFix->siMax; }
       }
 
       if (psArg->psFix->siTyp!=siTyp) {
          return CLPERR(psHdl,CLPERR_SEM,"The type (%s) of link '%s.%s' don't match the expected type (%s)",pcMapClpTyp(siTyp),fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
       }
-      if (psArg->psVar->siCnt>=psArg->psFix->siMax) {
+      if (GETVAR(psHdl,psArg)->siCnt>=psArg->psFix->siMax) {
          return CLPERR(psHdl,CLPERR_SEM,"Too many (>%d) occurrences of link '%s.%s' with type '%s'",psArg->psFix->siMax,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
       }
-      if (psArg->psVar->pvDat==NULL) {
+      if (GETVAR(psHdl,psArg)->pvDat==NULL) {
          return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of link are defined but data pointer not set",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
       }
 
       if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-         void** ppDat=(void**)psArg->psVar->pvDat;
-         (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+         void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+         (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
          if ((*ppDat)==NULL) {
-            return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for link '%s.%s' failed",psArg->psVar->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
+            return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for link '%s.%s' failed",GETVAR(psHdl,psArg)->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
          }
-         psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+         GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
       } else {
-         if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-            return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for link '%s.%s' with type '%s'",psArg->psVar->siRst,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
+         if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+            return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for link '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
          }
-         if (psArg->psVar->pvPtr==NULL) {
+         if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
             return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of link are defined but write pointer not set",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
          }
       }
@@ -6577,38 +8894,38 @@ static int siClpBldLnk(
          if (siVal<(-128) || siVal>255) {
             return CLPERR(psHdl,CLPERR_SEM,"Internal number (%"PRIi64") for link '%s.%s' need more than 8 Bit",isPrnInt(psArg,siVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
          }
-         *((I08*)psArg->psVar->pvPtr)=(I08)siVal;
+         *((I08*)GETVAR(psHdl,psArg)->pvPtr)=(I08)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LINK-I08(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       case 2:
          if (siVal<(-32768) || siVal>65535) {
             return CLPERR(psHdl,CLPERR_SEM,"Internal number (%"PRIi64") for link '%s.%s' need more than 16 Bit",isPrnInt(psArg,siVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
          }
-         *((I16*)psArg->psVar->pvPtr)=(I16)siVal;
+         *((I16*)GETVAR(psHdl,psArg)->pvPtr)=(I16)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LINK-I16(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       case 4:
          if (siVal<(-2147483648LL) || siVal>4294967295LL) {
             return CLPERR(psHdl,CLPERR_SEM,"Internal number (%"PRIi64") for link '%s.%s' need more than 32 Bit",isPrnInt(psArg,siVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
          }
-         *((I32*)psArg->psVar->pvPtr)=(I32)siVal;
+         *((I32*)GETVAR(psHdl,psArg)->pvPtr)=(I32)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LINK-I32(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       case 8:
-         *((I64*)psArg->psVar->pvPtr)=(I64)siVal;
+         *((I64*)GETVAR(psHdl,psArg)->pvPtr)=(I64)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LINK-I64(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       default: return CLPERR(psHdl,CLPERR_SIZ,"Size (%d) for the value (%"PRIi64") of link '%s.%s' is not 1, 2, 4 or 8)",psArg->psFix->siSiz,isPrnInt(psArg,siVal),fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
       }
 
-      psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-      psArg->psVar->siLen+=psArg->psFix->siSiz;
-      psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-      psArg->psVar->siCnt++;
+      GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siCnt++;
 
       return(psArg->psFix->siTyp);
    }
@@ -6628,10 +8945,10 @@ static int siClpBldSwt(
    if (psArg->psFix->siTyp!=siTyp) {
       return CLPERR(psHdl,CLPERR_SEM,"The type (%s) of switch '%s.%s' don't match the expected type (%s)",pcMapClpTyp(siTyp),pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
-   if (psArg->psVar->siCnt>=psArg->psFix->siMax) {
+   if (GETVAR(psHdl,psArg)->siCnt>=psArg->psFix->siMax) {
       return CLPERR(psHdl,CLPERR_SEM,"Too many (>%d) occurrences of switch '%s.%s' with type '%s'",psArg->psFix->siMax,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
    }
-   if (psArg->psVar->pvDat==NULL) {
+   if (GETVAR(psHdl,psArg)->pvDat==NULL) {
       return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of switch defined but data pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
 
@@ -6644,17 +8961,17 @@ static int siClpBldSwt(
    }
 
    if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-      void** ppDat=(void**)psArg->psVar->pvDat;
-      (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+      void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+      (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
       if ((*ppDat)==NULL) {
-         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for switch '%s.%s' failed",psArg->psVar->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for switch '%s.%s' failed",GETVAR(psHdl,psArg)->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
       }
-      psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+      GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
    } else {
-      if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for switch '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
+      if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for switch '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
       }
-      if (psArg->psVar->pvPtr==NULL) {
+      if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
          return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of switch are defined but write pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
       }
   }
@@ -6664,44 +8981,44 @@ static int siClpBldSwt(
       if (psArg->psFix->siOid<(-128) || psArg->psFix->siOid>65535) {
          return CLPERR(psHdl,CLPERR_SEM,"Object identifier (%"PRIi64") of '%s.%s' need more than 8 Bit",isPrnInt(psArg,psArg->psFix->siOid),pcPat,psArg->psStd->pcKyw);
       }
-      *((I08*)psArg->psVar->pvPtr)=(I08)psArg->psFix->siOid;
+      *((I08*)GETVAR(psHdl,psArg)->pvPtr)=(I08)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-SWITCH-I08(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    case 2:
       if (psArg->psFix->siOid<(-32768) || psArg->psFix->siOid>65535) {
          return CLPERR(psHdl,CLPERR_SEM,"Object identifier (%"PRIi64") of '%s.%s' need more than 16 Bit",isPrnInt(psArg,psArg->psFix->siOid),pcPat,psArg->psStd->pcKyw);
       }
-      *((I16*)psArg->psVar->pvPtr)=(I16)psArg->psFix->siOid;
+      *((I16*)GETVAR(psHdl,psArg)->pvPtr)=(I16)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-SWITCH-I16(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    case 4:
-      *((I32*)psArg->psVar->pvPtr)=(I32)psArg->psFix->siOid;
+      *((I32*)GETVAR(psHdl,psArg)->pvPtr)=(I32)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-SWITCH-I32(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    case 8:
-      *((I64*)psArg->psVar->pvPtr)=(I64)psArg->psFix->siOid;
+      *((I64*)GETVAR(psHdl,psArg)->pvPtr)=(I64)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-SWITCH-64(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    default:
       return CLPERR(psHdl,CLPERR_SIZ,"Size (%d) for the value (%"PRIi64") of '%s.%s' is not 1, 2, 4 or 8)",psArg->psFix->siSiz,isPrnInt(psArg,psArg->psFix->siOid),pcPat,psArg->psStd->pcKyw);
    }
 
-   psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-   psArg->psVar->siLen+=psArg->psFix->siSiz;
-   psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-   psArg->psVar->siCnt++;
+   GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siCnt++;
 
-   srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg)),"%s.%s=ON\n",pcPat,GETKYW(psArg));
+   srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg)),"%s.%s=ON\n",pcPat,GETKYW(psArg));
 
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siCnt,psArg->psFix->psCnt,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siCnt,psArg->psFix->psCnt,FALSE);
    if (siErr<0) { return(siErr); }
    siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siSiz,psArg->psFix->psEln,TRUE);
    if (siErr<0) { return(siErr); }
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psTln,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psTln,FALSE);
    if (siErr<0) { return(siErr); }
    if(psArg->psFix->siOid){
       siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siOid,psArg->psFix->psOid,TRUE);
@@ -6723,10 +9040,10 @@ static int siClpBldNum(
    if (psArg->psFix->siTyp!=siTyp) {
       return CLPERR(psHdl,CLPERR_SEM,"The type (%s) of argument '%s.%s' don't match the expected type (%s)",pcMapClpTyp(siTyp),pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
-   if (psArg->psVar->siCnt>=psArg->psFix->siMax) {
+   if (GETVAR(psHdl,psArg)->siCnt>=psArg->psFix->siMax) {
       return CLPERR(psHdl,CLPERR_SEM,"Too many (>%d) occurrences of argument '%s.%s' with type '%s'",psArg->psFix->siMax,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
    }
-   if (psArg->psVar->pvDat==NULL) {
+   if (GETVAR(psHdl,psArg)->pvDat==NULL) {
       return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument defined but data pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
 
@@ -6739,17 +9056,17 @@ static int siClpBldNum(
    }
 
    if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-      void** ppDat=(void**)psArg->psVar->pvDat;
-      (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+      void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+      (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
       if ((*ppDat)==NULL) {
-         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (1)",psArg->psVar->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (1)",GETVAR(psHdl,psArg)->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
       }
-      psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+      GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
    } else {
-      if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
+      if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
       }
-      if (psArg->psVar->pvPtr==NULL) {
+      if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
          return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument defined but write pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
       }
   }
@@ -6759,44 +9076,44 @@ static int siClpBldNum(
       if (psArg->psFix->siOid<(-128) || psArg->psFix->siOid>65535) {
          return CLPERR(psHdl,CLPERR_SEM,"Default value (%"PRIi64") of '%s.%s' need more than 8 Bit",isPrnInt(psArg,psArg->psFix->siOid),pcPat,psArg->psStd->pcKyw);
       }
-      *((I08*)psArg->psVar->pvPtr)=(I08)psArg->psFix->siOid;
+      *((I08*)GETVAR(psHdl,psArg)->pvPtr)=(I08)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-NUMBER-I08(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    case 2:
       if (psArg->psFix->siOid<(-32768) || psArg->psFix->siOid>65535) {
          return CLPERR(psHdl,CLPERR_SEM,"Default value (%"PRIi64") of '%s.%s' need more than 16 Bit",isPrnInt(psArg,psArg->psFix->siOid),pcPat,psArg->psStd->pcKyw);
       }
-      *((I16*)psArg->psVar->pvPtr)=(I16)psArg->psFix->siOid;
+      *((I16*)GETVAR(psHdl,psArg)->pvPtr)=(I16)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-NUMBER-I16(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    case 4:
-      *((I32*)psArg->psVar->pvPtr)=(I32)psArg->psFix->siOid;
+      *((I32*)GETVAR(psHdl,psArg)->pvPtr)=(I32)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-NUMBER-I32(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    case 8:
-      *((I64*)psArg->psVar->pvPtr)=(I64)psArg->psFix->siOid;
+      *((I64*)GETVAR(psHdl,psArg)->pvPtr)=(I64)psArg->psFix->siOid;
       TRACE(psHdl->pfBld,"%s BUILD-NUMBER-64(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                              fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
+                              fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,psArg->psFix->siOid));
       break;
    default:
       return CLPERR(psHdl,CLPERR_SIZ,"Size (%d) for the value (%"PRIi64") of '%s.%s' is not 1, 2, 4 or 8)",psArg->psFix->siSiz,isPrnInt(psArg,psArg->psFix->siOid),pcPat,psArg->psStd->pcKyw);
    }
 
-   psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-   psArg->psVar->siLen+=psArg->psFix->siSiz;
-   psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-   psArg->psVar->siCnt++;
+   GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siCnt++;
 
-   srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg))+16,"%s.%s=DEFAULT(%d)\n",pcPat,GETKYW(psArg),psArg->psFix->siOid);
+   srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg))+16,"%s.%s=DEFAULT(%d)\n",pcPat,GETKYW(psArg),psArg->psFix->siOid);
 
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siCnt,psArg->psFix->psCnt,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siCnt,psArg->psFix->psCnt,FALSE);
    if (siErr<0) { return(siErr); }
    siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siSiz,psArg->psFix->psEln,TRUE);
    if (siErr<0) { return(siErr); }
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psTln,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psTln,FALSE);
    if (siErr<0) { return(siErr); }
    if(psArg->psFix->siOid){
       siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siOid,psArg->psFix->psOid,TRUE);
@@ -6825,10 +9142,10 @@ static int siClpBldLit(
    TsSym*                        psCon;
    C08                           acTim[CSTIME_BUFSIZ];
 
-   if (psArg->psVar->siCnt>=psArg->psFix->siMax) {
+   if (GETVAR(psHdl,psArg)->siCnt>=psArg->psFix->siMax) {
       return CLPERR(psHdl,CLPERR_SEM,"Too many (>%d) occurrences of argument '%s.%s' with type '%s'",psArg->psFix->siMax,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
-   if (psArg->psVar->pvDat==NULL) {
+   if (GETVAR(psHdl,psArg)->pvDat==NULL) {
       return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument defined but data pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
 
@@ -6844,17 +9161,17 @@ static int siClpBldLit(
    case CLPTYP_SWITCH:
    case CLPTYP_NUMBER:
       if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-         void** ppDat=(void**)psArg->psVar->pvDat;
-         (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+         void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+         (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
          if ((*ppDat)==NULL) {
-            return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (2)",psArg->psVar->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+            return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (2)",GETVAR(psHdl,psArg)->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
          }
-         psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+         GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
       } else {
-         if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-            return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
+         if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+            return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
          }
-         if (psArg->psVar->pvPtr==NULL) {
+         if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
             return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument are defined but write pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
          }
       }
@@ -6868,9 +9185,9 @@ static int siClpBldLit(
          if (siVal<(-128) || siVal>255) {
             return CLPERR(psHdl,CLPERR_SEM,"Literal number (%s) of '%s.%s' need more than 8 Bit",isPrnStr(psArg,pcVal),pcPat,psArg->psStd->pcKyw);
          }
-         *((I08*)psArg->psVar->pvPtr)=(I08)siVal;
+         *((I08*)GETVAR(psHdl,psArg)->pvPtr)=(I08)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LITERAL-I08(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       case 2:
          if (siVal<0 && CLPISF_UNS(psArg->psStd->uiFlg)) {
@@ -6879,9 +9196,9 @@ static int siClpBldLit(
          if (siVal<(-32768) || siVal>65535) {
             return CLPERR(psHdl,CLPERR_SEM,"Literal number (%s) of '%s.%s' need more than 16 Bit",isPrnStr(psArg,pcVal),pcPat,psArg->psStd->pcKyw);
          }
-         *((I16*)psArg->psVar->pvPtr)=(I16)siVal;
+         *((I16*)GETVAR(psHdl,psArg)->pvPtr)=(I16)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LITERAL-I16(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       case 4:
          if (siVal<0 && CLPISF_UNS(psArg->psStd->uiFlg)) {
@@ -6890,37 +9207,37 @@ static int siClpBldLit(
          if (siVal<(-2147483648LL) || siVal>4294967295LL) {
             return CLPERR(psHdl,CLPERR_SEM,"Literal number (%s) of '%s.%s' need more than 32 Bit",isPrnStr(psArg,pcVal),pcPat,psArg->psStd->pcKyw);
          }
-         *((I32*)psArg->psVar->pvPtr)=(I32)siVal;
+         *((I32*)GETVAR(psHdl,psArg)->pvPtr)=(I32)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LITERAL-I32(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       case 8:
-         *((I64*)psArg->psVar->pvPtr)=(I64)siVal;
+         *((I64*)GETVAR(psHdl,psArg)->pvPtr)=(I64)siVal;
          TRACE(psHdl->pfBld,"%s BUILD-LITERAL-I64(PTR=%p CNT=%d LEN=%d RST=%d)%s=%"PRIi64"\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnInt(psArg,siVal));
          break;
       default:
          return CLPERR(psHdl,CLPERR_SIZ,"Size (%d) for the value (%s) of '%s.%s' is not 1, 2, 4 or 8)",psArg->psFix->siSiz,isPrnStr(psArg,pcVal),pcPat,psArg->psStd->pcKyw);
       }
-      psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-      psArg->psVar->siLen+=psArg->psFix->siSiz;
-      psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-      siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psEln,FALSE);
+      GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+      siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psEln,FALSE);
       if (siErr<0) { return(siErr); }
       break;
    case CLPTYP_FLOATN:
       if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-         void** ppDat=(void**)psArg->psVar->pvDat;
-         (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+         void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+         (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
          if ((*ppDat)==NULL) {
-            return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (3)",psArg->psVar->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+            return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (3)",GETVAR(psHdl,psArg)->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
          }
-         psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+         GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
       } else {
-         if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-            return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
+         if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+            return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
          }
-         if (psArg->psVar->pvPtr==NULL) {
+         if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
             return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument are defined but write pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
          }
       }
@@ -6931,45 +9248,45 @@ static int siClpBldLit(
       }
       switch (psArg->psFix->siSiz) {
       case 4:
-         *((F32*)psArg->psVar->pvPtr)=flVal;
+         *((F32*)GETVAR(psHdl,psArg)->pvPtr)=flVal;
          TRACE(psHdl->pfBld,"%s BUILD-LITERAL-F32(PTR=%p CNT=%d LEN=%d RST=%d)%s=%f\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnFlt(psArg,flVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnFlt(psArg,flVal));
          break;
       case 8:
-         *((F64*)psArg->psVar->pvPtr)=flVal;
+         *((F64*)GETVAR(psHdl,psArg)->pvPtr)=flVal;
          TRACE(psHdl->pfBld,"%s BUILD-LITERAL-F64(PTR=%p CNT=%d LEN=%d RST=%d)%s=%f\n",
-                                 fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnFlt(psArg,flVal));
+                                 fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnFlt(psArg,flVal));
          break;
       default: return CLPERR(psHdl,CLPERR_SIZ,"Size (%d) for the value (%s) of '%s.%s' is not 4 (float) or 8 (double))",psArg->psFix->siSiz,isPrnStr(psArg,pcVal),pcPat,psArg->psStd->pcKyw);
       }
-      psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-      psArg->psVar->siLen+=psArg->psFix->siSiz;
-      psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-      siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psEln,FALSE);
+      GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+      GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+      siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psEln,FALSE);
       if (siErr<0) { return(siErr); }
       break;
    case CLPTYP_STRING:
       if (CLPISF_FIX(psArg->psStd->uiFlg)) {
          l0=psArg->psFix->siSiz;
          if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-            void** ppDat=(void**)psArg->psVar->pvDat;
-            (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+            void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+            (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
             if ((*ppDat)==NULL) {
-               return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (4)",psArg->psVar->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+               return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d*%d)) for argument '%s.%s' failed (4)",GETVAR(psHdl,psArg)->siLen,(CLPISF_DLM(psArg->psStd->uiFlg))?2:1,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
             }
-            psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+            GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
          } else {
-            if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-               return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
+            if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+               return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
             }
-            if (psArg->psVar->pvPtr==NULL) {
+            if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
                return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument are defined but write pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
             }
          }
       } else {
-         l0=psArg->psVar->siRst;
+         l0=GETVAR(psHdl,psArg)->siRst;
          if (!CLPISF_DYN(psArg->psStd->uiFlg)) {
-            if (psArg->psVar->pvPtr==NULL) {
+            if (GETVAR(psHdl,psArg)->pvPtr==NULL) {
                return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument are defined but write pointer not set",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
             }
          }
@@ -6986,116 +9303,116 @@ static int siClpBldLit(
             }
             if ((l1/2)>l0) {
                if (CLPISF_DYN(psArg->psStd->uiFlg) && !CLPISF_FIX(psArg->psStd->uiFlg)) {
-                  void** ppDat=(void**)psArg->psVar->pvDat;
-                  if (psArg->psVar->siLen+(l1/2)>psArg->psFix->siSiz) {
+                  void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+                  if (GETVAR(psHdl,psArg)->siLen+(l1/2)>psArg->psFix->siSiz) {
                      return CLPERR(psHdl,CLPERR_MEM,"Size limit (%d) reached for argument '%s.%s'",psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
                   }
-                  (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+(l1/2)+4,&psArg->psVar->siInd,psArg->psStd->uiFlg);
+                  (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+(l1/2)+4);
                   if ((*ppDat)==NULL) {
-                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d/+2)+4) for argument '%s.%s' failed (5)",psArg->psVar->siLen,l1,pcPat,psArg->psStd->pcKyw);
+                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+(%d/+2)+4) for argument '%s.%s' failed (5)",GETVAR(psHdl,psArg)->siLen,l1,pcPat,psArg->psStd->pcKyw);
                   }
-                  psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+                  GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
                } else {
                   return CLPERR(psHdl,CLPERR_LEX,"Hexadecimal string (%c(%s)) of '%s.%s' is longer than %d",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,2*l0);
                }
             }
-            l2=hex2bin(pcVal+2,(U08*)psArg->psVar->pvPtr,l1);
+            l2=hex2bin(pcVal+2,(U08*)GETVAR(psHdl,psArg)->pvPtr,l1);
             if (l2!=l1/2) {
                return CLPERR(psHdl,CLPERR_SEM,"Hexadecimal string (%c(%s)) of '%s.%s' cannot be converted from hex to bin (error after %d bytes)",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,l2*2);
             }
             siSln=l2;
-            ((char*)psArg->psVar->pvPtr)[l2]=EOS;
+            ((char*)GETVAR(psHdl,psArg)->pvPtr)[l2]=EOS;
             if (!CLPISF_BIN(psArg->psStd->uiFlg)) {
                // parameter is not flagged as binary => check that data does not contain \0
-               U32 uiStrLen = strlen((char*)psArg->psVar->pvPtr);
+               U32 uiStrLen = strlen((char*)GETVAR(psHdl,psArg)->pvPtr);
                if (uiStrLen != l2) {
                   return CLPERR(psHdl,CLPERR_SEM,"HEX string contains NUL-bytes at offset %d which is not allowed for argument '%s.%s' (not flagged as binary)",uiStrLen,pcPat,psArg->psStd->pcKyw);
                }
             }
             TRACE(psHdl->pfBld,"%s BUILD-LITERAL-HEX(PTR=%p CNT=%d LEN=%d RST=%d)%s=%s(%d)\n",
-                                    fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
+                                    fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
             break;
          case 'a':
             l1=strlen(pcVal+2);
             if (l1>l0) {
                if (CLPISF_DYN(psArg->psStd->uiFlg)&& !CLPISF_FIX(psArg->psStd->uiFlg)) {
-                  void** ppDat=(void**)psArg->psVar->pvDat;
-                  if (psArg->psVar->siLen+l1>psArg->psFix->siSiz) {
+                  void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+                  if (GETVAR(psHdl,psArg)->siLen+l1>psArg->psFix->siSiz) {
                      return CLPERR(psHdl,CLPERR_MEM,"Size limit (%d) reached for argument '%s.%s'",psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
                   }
-                  (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+l1+4,&psArg->psVar->siInd,psArg->psStd->uiFlg);
+                  (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+l1+4);
                   if ((*ppDat)==NULL) {
-                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (6)",psArg->psVar->siLen,l1,pcPat,psArg->psStd->pcKyw);
+                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (6)",GETVAR(psHdl,psArg)->siLen,l1,pcPat,psArg->psStd->pcKyw);
                   }
-                  psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+                  GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
                } else {
                   return CLPERR(psHdl,CLPERR_LEX,"ASCII string (%c(%s)) of '%s.%s' is longer than %d",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,l0);
                }
             }
-            l2=chr2asc(pcVal+2,(C08*)psArg->psVar->pvPtr,l1);
+            l2=chr2asc(pcVal+2,(C08*)GETVAR(psHdl,psArg)->pvPtr,l1);
             if (l2!=l1) {
                return CLPERR(psHdl,CLPERR_SEM,"ASCII string (%c(%s)) of '%s.%s' cannot be converted to ASCII (error after %d bytes)",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,l2);
             }
             siSln=l2;
-            ((char*)psArg->psVar->pvPtr)[l2]=EOS;
+            ((char*)GETVAR(psHdl,psArg)->pvPtr)[l2]=EOS;
             TRACE(psHdl->pfBld,"%s BUILD-LITERAL-ASC(PTR=%p CNT=%d LEN=%d RST=%d)%s=%s(%d)\n",
-                                    fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
+                                    fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
             break;
          case 'e':
             l1=strlen(pcVal+2);
             if (l1>l0) {
                if (CLPISF_DYN(psArg->psStd->uiFlg) && !CLPISF_FIX(psArg->psStd->uiFlg)) {
-                  void** ppDat=(void**)psArg->psVar->pvDat;
-                  if (psArg->psVar->siLen+l1>psArg->psFix->siSiz) {
+                  void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+                  if (GETVAR(psHdl,psArg)->siLen+l1>psArg->psFix->siSiz) {
                      return CLPERR(psHdl,CLPERR_MEM,"Size limit (%d) reached for argument '%s.%s'",psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
                   }
-                  (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+l1+4,&psArg->psVar->siInd,psArg->psStd->uiFlg);
+                  (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+l1+4);
                   if ((*ppDat)==NULL) {
-                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (7)",psArg->psVar->siLen,l1,pcPat,psArg->psStd->pcKyw);
+                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (7)",GETVAR(psHdl,psArg)->siLen,l1,pcPat,psArg->psStd->pcKyw);
                   }
-                  psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+                  GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
                } else {
                   return CLPERR(psHdl,CLPERR_LEX,"EBCDIC string (%c(%s)) of '%s.%s' is longer than %d",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,l0);
                }
             }
-            l2=chr2ebc(pcVal+2,(C08*)psArg->psVar->pvPtr,l1);
+            l2=chr2ebc(pcVal+2,(C08*)GETVAR(psHdl,psArg)->pvPtr,l1);
             if (l2!=l1) {
                return CLPERR(psHdl,CLPERR_SEM,"EBCDIC string (%c(%s)) of '%s.%s' cannot be converted to EBCDIC (error after %d bytes)",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,l2);
             }
             siSln=l2;
-            ((char*)psArg->psVar->pvPtr)[l2]=EOS;
+            ((char*)GETVAR(psHdl,psArg)->pvPtr)[l2]=EOS;
             TRACE(psHdl->pfBld,"%s BUILD-LITERAL-EBC(PTR=%p CNT=%d LEN=%d RST=%d)%s=%s(%d)\n",
-                                    fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
+                                    fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
             break;
          case 'c':
             l1=strlen(pcVal+2);
             if (l1>l0) {
                if (CLPISF_DYN(psArg->psStd->uiFlg)&& !CLPISF_FIX(psArg->psStd->uiFlg)) {
-                  void** ppDat=(void**)psArg->psVar->pvDat;
-                  if (psArg->psVar->siLen+l1>psArg->psFix->siSiz) {
+                  void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+                  if (GETVAR(psHdl,psArg)->siLen+l1>psArg->psFix->siSiz) {
                      return CLPERR(psHdl,CLPERR_MEM,"Size limit (%d) reached for argument '%s.%s'",psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
                   }
-                  (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+l1+4,&psArg->psVar->siInd,psArg->psStd->uiFlg);
+                  (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+l1+4);
                   if ((*ppDat)==NULL) {
-                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (8)",psArg->psVar->siLen,l1,pcPat,psArg->psStd->pcKyw);
+                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (8)",GETVAR(psHdl,psArg)->siLen,l1,pcPat,psArg->psStd->pcKyw);
                   }
-                  psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+                  GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
                } else {
                   return CLPERR(psHdl,CLPERR_LEX,"Character string (%c(%s)) of '%s.%s' is longer than %d",pcVal[0],isPrnStr(psArg,pcVal+2),pcPat,psArg->psStd->pcKyw,l0);
                }
             }
-            memcpy(psArg->psVar->pvPtr,pcVal+2,l1);
+            memcpy(GETVAR(psHdl,psArg)->pvPtr,pcVal+2,l1);
             siSln=l2=l1;
-            ((char*)psArg->psVar->pvPtr)[l2]=EOS;
+            ((char*)GETVAR(psHdl,psArg)->pvPtr)[l2]=EOS;
             if (!CLPISF_BIN(psArg->psStd->uiFlg)) {
                // parameter is not flagged as binary => check that data does not contain \0
-               U32 uiStrLen = strlen((char*)psArg->psVar->pvPtr);
+               U32 uiStrLen = strlen((char*)GETVAR(psHdl,psArg)->pvPtr);
                if (uiStrLen != l2) {
                   return CLPERR(psHdl,CLPERR_SEM,"String contains NUL-bytes at offset %d which is not allowed for argument '%s.%s' (not flagged as binary)",uiStrLen,pcPat,psArg->psStd->pcKyw);
                }
             }
             TRACE(psHdl->pfBld,"%s BUILD-LITERAL-CHR(PTR=%p CNT=%d LEN=%d RST=%d)%s=%s(%d)\n",
-                                    fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
+                                    fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
             break;
          case 's':
             if (CLPISF_XML(psArg->psStd->uiFlg)) {
@@ -7113,34 +9430,35 @@ static int siClpBldLit(
             l1=strlen(pcHlp);
             if (l1+1>l0) {
                if (CLPISF_DYN(psArg->psStd->uiFlg) && !CLPISF_FIX(psArg->psStd->uiFlg)) {
-                  void** ppDat=(void**)psArg->psVar->pvDat;
-                  if (psArg->psVar->siLen+l1+1>psArg->psFix->siSiz) {
+                  void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+                  if (GETVAR(psHdl,psArg)->siLen+l1+1>psArg->psFix->siSiz) {
                      free(pcHlp);
                      return CLPERR(psHdl,CLPERR_MEM,"Size limit (%d) reached for argument '%s.%s'",psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
                   }
-                  (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+l1+4,&psArg->psVar->siInd,psArg->psStd->uiFlg);
+                  (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+l1+4);
                   if ((*ppDat)==NULL) {
                      free(pcHlp);
-                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (9)",psArg->psVar->siLen,l1,pcPat,psArg->psStd->pcKyw);
+                     return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d+4) for argument '%s.%s' failed (9)",GETVAR(psHdl,psArg)->siLen,l1,pcPat,psArg->psStd->pcKyw);
                   }
-                  psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+                  GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
                } else {
                   siErr=CLPERR(psHdl,CLPERR_LEX,"Character string (%c(%s)) of '%s.%s' is longer than %d",pcVal[0],isPrnStr(psArg,pcHlp),pcPat,psArg->psStd->pcKyw,l0-1);
                   free(pcHlp);
                   return(siErr);
                }
             }
-            memcpy(psArg->psVar->pvPtr,pcHlp,l1);
-            ((char*)psArg->psVar->pvPtr)[l1]=EOS;
+            memcpy(GETVAR(psHdl,psArg)->pvPtr,pcHlp,l1);
+            ((char*)GETVAR(psHdl,psArg)->pvPtr)[l1]=EOS;
             free(pcHlp);
             siSln=l1; l2=l1+1;
             TRACE(psHdl->pfBld,"%s BUILD-LITERAL-STR(PTR=%p CNT=%d LEN=%d RST=%d)%s=%s(%d)\n",
-                                    fpcPre(psHdl,siLev),psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
+                                    fpcPre(psHdl,siLev),GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst,psArg->psStd->pcKyw,isPrnStr(psArg,pcVal),isPrnLen(psArg,l2));
             break;
          case 'f':
          {
             int                           siTok;
             int                           siRow;
+            size_t                        szInp;
             int                           siSiz=0;
             char*                         pcDat=NULL;
             const char*                   pcCur;
@@ -7164,7 +9482,7 @@ static int siClpBldLit(
             strcpy(acSrc,psHdl->pcSrc);
             srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(CLPSRC_SRF)+strlen(pcVal+2),"%s%s",CLPSRC_SRF,pcVal+2);
 
-            pcInp=psHdl->pcInp; psHdl->pcInp=pcClpUnEscape(psHdl,pcDat);
+            pcInp=psHdl->pcInp; psHdl->pcInp=pcClpUnEscape(psHdl,pcDat,TRUE);
             SAFE_FREE(pcDat);
             if (psHdl->pcInp==NULL) {
                siErr=CLPERR(psHdl,CLPERR_MEM,"Un-escaping of string file (%s) failed",pcVal+2);
@@ -7175,6 +9493,7 @@ static int siClpBldLit(
             pcOld=psHdl->pcOld; psHdl->pcOld=psHdl->pcInp;
             pcRow=psHdl->pcRow; psHdl->pcRow=psHdl->pcInp;
             siRow=psHdl->siRow; psHdl->siRow=1;
+            szInp=psHdl->szInp; psHdl->szInp=0;
             psHdl->siBuf++;
             siTok=siClpScnNat(psHdl,psHdl->pfErr,psHdl->pfScn,&psHdl->pcCur,&szLex,&pcLex,CLPTYP_STRING,psArg,NULL,NULL);
             if (siTok<0) {
@@ -7194,7 +9513,7 @@ static int siClpBldLit(
             siErr=siClpBldLit(psHdl,siLev,siPos,psArg,pcLex);
             psHdl->siBuf--;
             strcpy(psHdl->pcSrc,acSrc);
-            psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow;
+            psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow; psHdl->szInp=szInp;
             TRACE(psHdl->pfPrs,"STRING-FILE-END(%s)\n",pcVal+2);
             free(pcLex);
             return(siErr);
@@ -7230,19 +9549,19 @@ static int siClpBldLit(
       } while (isNotDone);
 
       if (CLPISF_FIX(psArg->psStd->uiFlg)) {
-         memset(((U08*)psArg->psVar->pvPtr)+l2,0,psArg->psFix->siSiz-l2);
-         psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-         psArg->psVar->siLen+=psArg->psFix->siSiz;
-         psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+         memset(((U08*)GETVAR(psHdl,psArg)->pvPtr)+l2,0,psArg->psFix->siSiz-l2);
+         GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+         GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+         GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
          siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siSiz,psArg->psFix->psEln,TRUE);
          if (siErr<0) { return(siErr); }
       } else {
          if (CLPISF_DLM(psArg->psStd->uiFlg)) {
-            ((char*)psArg->psVar->pvPtr)[l2]=0xFF; // end of string list
+            ((char*)GETVAR(psHdl,psArg)->pvPtr)[l2]=0xFF; // end of string list
          }
-         psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+l2;
-         psArg->psVar->siLen+=l2;
-         psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:l2;
+         GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+l2;
+         GETVAR(psHdl,psArg)->siLen+=l2;
+         GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:l2;
          siErr=siClpBldLnk(psHdl,siLev,siPos,l2,psArg->psFix->psEln,TRUE);
          if (siErr<0) { return(siErr); }
       }
@@ -7251,27 +9570,27 @@ static int siClpBldLit(
       break;
    default: return CLPERR(psHdl,CLPERR_TYP,"Type (%d) of parameter '%s.%s' not supported in this case (literal)",psArg->psFix->siTyp,pcPat,psArg->psStd->pcKyw);
    }
-   psArg->psVar->siCnt++;
+   GETVAR(psHdl,psArg)->siCnt++;
 
    for (psCon=psArg->psDep;psCon!=NULL;psCon=psCon->psNxt) {
       if (pcKyw==NULL && psCon->psFix->siTyp==psArg->psFix->siTyp) {
          switch (psCon->psFix->siTyp) {
          case CLPTYP_NUMBER:
             switch (psCon->psFix->siSiz) {
-            case 1: if (siVal==((I08*)psCon->psVar->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
-            case 2: if (siVal==((I16*)psCon->psVar->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
-            case 4: if (siVal==((I32*)psCon->psVar->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
-            case 8: if (siVal==((I64*)psCon->psVar->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
+            case 1: if (siVal==((I08*)GETVAR(psHdl,psCon)->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
+            case 2: if (siVal==((I16*)GETVAR(psHdl,psCon)->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
+            case 4: if (siVal==((I32*)GETVAR(psHdl,psCon)->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
+            case 8: if (siVal==((I64*)GETVAR(psHdl,psCon)->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
             }
             break;
          case CLPTYP_FLOATN:
             switch (psCon->psFix->siSiz) {
-            case 4: if (flVal==((F32*)psCon->psVar->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
-            case 8: if (flVal==((F64*)psCon->psVar->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
+            case 4: if (flVal==((F32*)GETVAR(psHdl,psCon)->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
+            case 8: if (flVal==((F64*)GETVAR(psHdl,psCon)->pvDat)[0]) { pcKyw=psCon->psStd->pcKyw; } break;
             }
             break;
          default:
-            if (l2>0 && psCon->psVar->siLen==l2 && memcmp(psCon->psVar->pvDat,((char*)psArg->psVar->pvPtr)-l2,l2)==0) {
+            if (l2>0 && GETVAR(psHdl,psCon)->siLen==l2 && memcmp(GETVAR(psHdl,psCon)->pvDat,((char*)GETVAR(psHdl,psArg)->pvPtr)-l2,l2)==0) {
                pcKyw=psCon->psStd->pcKyw;
             }
             break;
@@ -7280,22 +9599,22 @@ static int siClpBldLit(
    }
 
    if (pcKyw!=NULL) {
-      if (psArg->psFix->siTyp==CLPTYP_NUMBER && (CLPISF_TIM(psArg->psStd->uiFlg) || pcVal[0]=='t')) {
-         srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal))+strlen(cstime(siVal,acTim)),"%s.%s=%s(%s(%s))\n",pcPat,GETKYW(psArg),pcKyw,isPrnStr(psArg,pcVal),acTim);
+      if (psArg->psFix->siTyp==CLPTYP_NUMBER && (CLPISF_TIM(psArg->psStd->uiFlg|GETDFL(psHdl,psArg)) || pcVal[0]=='t')) {
+         srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal))+strlen(cstime(siVal,acTim)),"%s.%s=%s(%s(%s))\n",pcPat,GETKYW(psArg),pcKyw,isPrnStr(psArg,pcVal),acTim);
       } else {
-         srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal)),"%s.%s=%s(%s)\n",pcPat,GETKYW(psArg),pcKyw,isPrnStr(psArg,pcVal));
+         srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal)),"%s.%s=%s(%s)\n",pcPat,GETKYW(psArg),pcKyw,isPrnStr(psArg,pcVal));
       }
    } else {
-      if (psArg->psFix->siTyp==CLPTYP_NUMBER && (CLPISF_TIM(psArg->psStd->uiFlg) || pcVal[0]=='t')) {
-         srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal))+strlen(cstime(siVal,acTim)),"%s.%s=%s(%s)\n",pcPat,GETKYW(psArg),isPrnStr(psArg,pcVal),acTim);
+      if (psArg->psFix->siTyp==CLPTYP_NUMBER && (CLPISF_TIM(psArg->psStd->uiFlg|GETDFL(psHdl,psArg)) || pcVal[0]=='t')) {
+         srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal))+strlen(cstime(siVal,acTim)),"%s.%s=%s(%s)\n",pcPat,GETKYW(psArg),isPrnStr(psArg,pcVal),acTim);
       } else {
-         srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal)),"%s.%s=%s\n",pcPat,GETKYW(psArg),isPrnStr(psArg,pcVal));
+         srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg))+strlen(isPrnStr(psArg,pcVal)),"%s.%s=%s\n",pcPat,GETKYW(psArg),isPrnStr(psArg,pcVal));
       }
    }
 
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siCnt,psArg->psFix->psCnt,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siCnt,psArg->psFix->psCnt,FALSE);
    if (siErr<0) { return(siErr); }
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psTln,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psTln,FALSE);
    if (siErr<0) { return(siErr); }
    if(psArg->psFix->siOid){
       siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siOid,psArg->psFix->psOid,TRUE);
@@ -7304,13 +9623,32 @@ static int siClpBldLit(
    return(psArg->psFix->siTyp);
 }
 
+static TsVar* psClpSavPsh(
+   TsHdl*                        psHdl,
+   const int                     siCnt,
+   int*                          piSav)
+{
+   if (psHdl->siSav+siCnt>psHdl->szSav) {
+      int                        szSav=(psHdl->szSav)?psHdl->szSav:CLPINI_SAVCNT;
+      void*                      pvHlp;
+      while (szSav<psHdl->siSav+siCnt) { szSav*=2; }
+      pvHlp=realloc_nowarn(psHdl->psSav,sizeof(TsVar)*szSav);
+      if (pvHlp==NULL) { return(NULL); }
+      psHdl->psSav=(TsVar*)pvHlp;
+      psHdl->szSav=szSav;
+   }
+   *piSav=psHdl->siSav;
+   psHdl->siSav+=siCnt;
+   return(psHdl->psSav+(*piSav));
+}
+
 static int siClpIniMainObj(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   TsVar                         asSav[])
+   int*                          piSav)
 {
    const char*                   pcPat=fpcPat(psHdl,0);
-   TsSym*                        psHlp;
+   const TsSym*                  psHlp;
 
    if (psTab->psBak!=NULL) {
       return CLPERR(psHdl,CLPERR_INT,"Entry '%s.%s' not at beginning of a table (2)",pcPat,psTab->psStd->pcKyw);
@@ -7323,15 +9661,22 @@ static int siClpIniMainObj(
    }
 
    if (psHdl->pvDat!=NULL) {
-      for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) {
-         asSav[0]=psHlp->psVar[0];
-         psHlp->psVar->pvDat=((char*)psHdl->pvDat)+psHlp->psFix->siOfs;
-         psHlp->psVar->pvPtr=psHlp->psVar->pvDat;
-         psHlp->psVar->siCnt=0;
-         psHlp->psVar->siLen=0;
-         psHlp->psVar->siInd=0;
-         psHlp->psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
-         if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psHlp->psVar->siRst*=psHlp->psFix->siMax; }
+      TsVar*       psSav=psClpSavPsh(psHdl,psTab->psIdx->siEnt,piSav);
+      if (psSav==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to save values of parameter table '%s' failed",pcPat);
+      }
+      for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
+         if (!CLPISF_ALI(psHlp->psStd->uiFlg)) {
+            TsVar* psVar=psHdl->psVar+psHlp->siVar;
+            *psSav++=psVar[0];
+            psVar->pvDat=((char*)psHdl->pvDat)+psHlp->psFix->siOfs;
+            psVar->pvPtr=psVar->pvDat;
+            psVar->siCnt=0;
+            psVar->siLen=0;
+            psVar->siInd=0;
+            psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
+            if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psVar->siRst*=psHlp->psFix->siMax; }
+         }
       }
    } else {
       return CLPERR(psHdl,CLPERR_PAR,"Pointer to CLP data structure is NULL (%s.%s)",pcPat,psTab->psStd->pcKyw);
@@ -7344,7 +9689,7 @@ static int siClpIniMainObj(
 static int siClpFinMainObj(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   const TsVar                   asSav[])
+   const int                     siSav)
 {
    TsSym*                        psHlp=NULL;
    int                           i;
@@ -7363,16 +9708,16 @@ static int siClpFinMainObj(
 
    if (psHdl->isChk) {
       for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
-         if (psHlp->psVar->siCnt<psHlp->psFix->siMin) {
+         if (GETVAR(psHdl,psHlp)->siCnt<psHlp->psFix->siMin) {
             if (psHlp->psFix->siMin<=1) {
                CLPERR(psHdl,CLPERR_SEM,"Parameter '%s.%s' not specified",fpcPat(psHdl,0),psHlp->psStd->pcKyw);
                CLPERRADD(psHdl,0,"Please specify parameter:%s","");
-               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                            CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
             } else {
-               CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s' is smaller than required minimum amount (%d)",psHlp->psVar->siCnt,fpcPat(psHdl,0),psHlp->psStd->pcKyw,psHlp->psFix->siMin);
+               CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s' is smaller than required minimum amount (%d)",GETVAR(psHdl,psHlp)->siCnt,fpcPat(psHdl,0),psHlp->psStd->pcKyw,psHlp->psFix->siMin);
                CLPERRADD(psHdl,0,"Please specify parameter additionally %d times:%s","");
-               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                            CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
             }
             return(CLPERR_SEM);
@@ -7380,7 +9725,11 @@ static int siClpFinMainObj(
       }
    }
 
-   for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) { psHlp->psVar[0]=asSav[0]; }
+   const TsVar* psSav=psHdl->psSav+siSav;
+   for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (!CLPISF_ALI(psHlp->psStd->uiFlg)) { psHdl->psVar[psHlp->siVar]=*psSav++; }
+   }
+   psHdl->siSav=siSav;
 
    TRACE(psHdl->pfBld,"BUILD-END-MAIN-ARGUMENT-LIST\n");
    return(CLP_OK);
@@ -7389,10 +9738,10 @@ static int siClpFinMainObj(
 static int siClpIniMainOvl(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   TsVar                         asSav[])
+   int*                          piSav)
 {
    const char*                   pcPat=fpcPat(psHdl,0);
-   TsSym*                        psHlp;
+   const TsSym*                  psHlp;
 
    if (psTab->psBak!=NULL) {
       return CLPERR(psHdl,CLPERR_INT,"Entry '%s.%s' not at beginning of a table (4)",pcPat,psTab->psStd->pcKyw);
@@ -7405,15 +9754,22 @@ static int siClpIniMainOvl(
    }
 
    if (psHdl->pvDat!=NULL) {
-      for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) {
-         asSav[0]=psHlp->psVar[0];
-         psHlp->psVar->pvDat=((char*)psHdl->pvDat);
-         psHlp->psVar->pvPtr=psHlp->psVar->pvDat;
-         psHlp->psVar->siCnt=0;
-         psHlp->psVar->siLen=0;
-         psHlp->psVar->siInd=0;
-         psHlp->psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
-         if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psHlp->psVar->siRst*=psHlp->psFix->siMax; }
+      TsVar*       psSav=psClpSavPsh(psHdl,psTab->psIdx->siEnt,piSav);
+      if (psSav==NULL) {
+         return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to save values of parameter table '%s' failed",pcPat);
+      }
+      for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
+         if (!CLPISF_ALI(psHlp->psStd->uiFlg)) {
+            TsVar* psVar=psHdl->psVar+psHlp->siVar;
+            *psSav++=psVar[0];
+            psVar->pvDat=((char*)psHdl->pvDat);
+            psVar->pvPtr=psVar->pvDat;
+            psVar->siCnt=0;
+            psVar->siLen=0;
+            psVar->siInd=0;
+            psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
+            if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psVar->siRst*=psHlp->psFix->siMax; }
+         }
       }
    } else {
       return CLPERR(psHdl,CLPERR_PAR,"Pointer to CLP data structure is NULL (%s.%s)",pcPat,psTab->psStd->pcKyw);
@@ -7426,7 +9782,7 @@ static int siClpIniMainOvl(
 static int siClpFinMainOvl(
    TsHdl*                        psHdl,
    TsSym*                        psTab,
-   const TsVar                   asSav[],
+   const int                     siSav,
    const int                     siOid)
 {
    TsSym*                        psHlp=NULL;
@@ -7449,16 +9805,16 @@ static int siClpFinMainOvl(
    if (psHdl->isChk) {
       for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
          if (psHlp->psFix->siOid==siOid) {
-            if (psHlp->psVar->siCnt<psHlp->psFix->siMin) {
+            if (GETVAR(psHdl,psHlp)->siCnt<psHlp->psFix->siMin) {
                if (psHlp->psFix->siMin<=1) {
                   CLPERR(psHdl,CLPERR_SEM,"Parameter '%s.%s' not specified",fpcPat(psHdl,0),psHlp->psStd->pcKyw);
                   CLPERRADD(psHdl,0,"Please specify parameter:%s","");
-                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                               CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_SEL(psHlp->psStd->uiFlg));
                } else {
-                  CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s' is smaller than required minimum amount (%d)",psHlp->psVar->siCnt,fpcPat(psHdl,0),psHlp->psStd->pcKyw,psHlp->psFix->siMin);
+                  CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s' is smaller than required minimum amount (%d)",GETVAR(psHdl,psHlp)->siCnt,fpcPat(psHdl,0),psHlp->psStd->pcKyw,psHlp->psFix->siMin);
                   CLPERRADD(psHdl,0,"Please specify parameter additionally %d times:%s","");
-                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                               CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
                }
                return(CLPERR_SEM);
@@ -7467,7 +9823,11 @@ static int siClpFinMainOvl(
       }
    }
 
-   for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) { psHlp->psVar[0]=asSav[0]; }
+   const TsVar* psSav=psHdl->psSav+siSav;
+   for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (!CLPISF_ALI(psHlp->psStd->uiFlg)) { psHdl->psVar[psHlp->siVar]=*psSav++; }
+   }
+   psHdl->siSav=siSav;
 
    TRACE(psHdl->pfBld,"BUILD-END-MAIN-ARGUMENT\n");
    return(CLP_OK);
@@ -7479,18 +9839,18 @@ static int siClpIniObj(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym**                       ppDep,
-   TsVar                         asSav[])
+   int*                          piSav)
 {
    int                           siErr;
    const int                     siTyp=CLPTYP_OBJECT;
    const char*                   pcPat=fpcPat(psHdl,siLev);
-   TsSym*                        psHlp;
+   const TsSym*                  psHlp;
    (void)siPos;
 
    if (psArg->psFix->siTyp!=siTyp) {
       return CLPERR(psHdl,CLPERR_SEM,"The type (%s) of argument '%s.%s' don't match the expected type (%s)",pcMapClpTyp(siTyp),pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
-   if (psArg->psVar->siCnt>=psArg->psFix->siMax) {
+   if (GETVAR(psHdl,psArg)->siCnt>=psArg->psFix->siMax) {
       return CLPERR(psHdl,CLPERR_SEM,"Too many (>%d) occurrences of '%s.%s' with type '%s'",psArg->psFix->siMax,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
 
@@ -7503,19 +9863,19 @@ static int siClpIniObj(
    }
 
    if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-      void** ppDat=(void**)psArg->psVar->pvDat;
-      (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+      void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+      (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
       if ((*ppDat)==NULL) {
-         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d) for object '%s.%s' failed",psArg->psVar->siLen,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d) for object '%s.%s' failed",GETVAR(psHdl,psArg)->siLen,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
       }
-      psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+      GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
    } else {
-      if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
+      if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
       }
    }
 
-   srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg)),"%s.%s(\n",pcPat,GETKYW(psArg));
+   srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg)),"%s.%s(\n",pcPat,GETKYW(psArg));
 
    siErr=siExtentSymTab(psHdl,siLev,psArg);
    if (siErr<0) { return(siErr); }
@@ -7523,19 +9883,26 @@ static int siClpIniObj(
       return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument defined but pointer to parameter table not set (1)",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
    }
 
-   for (psHlp=psArg->psDep;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) {
-      asSav[0]=psHlp->psVar[0];
-      psHlp->psVar->pvDat=((char*)psArg->psVar->pvPtr)+psHlp->psFix->siOfs;
-      psHlp->psVar->pvPtr=psHlp->psVar->pvDat;
-      psHlp->psVar->siCnt=0;
-      psHlp->psVar->siLen=0;
-      psHlp->psVar->siInd=0;
-      psHlp->psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
-      if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psHlp->psVar->siRst*=psHlp->psFix->siMax; }
+   TsVar*       psSav=psClpSavPsh(psHdl,psArg->psDep->psIdx->siEnt,piSav);
+   if (psSav==NULL) {
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to save values of parameter table '%s' failed",fpcPat(psHdl,siLev));
+   }
+   for (psHlp=psArg->psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (!CLPISF_ALI(psHlp->psStd->uiFlg)) {
+         TsVar* psVar=psHdl->psVar+psHlp->siVar;
+         *psSav++=psVar[0];
+         psVar->pvDat=((char*)GETVAR(psHdl,psArg)->pvPtr)+psHlp->psFix->siOfs;
+         psVar->pvPtr=psVar->pvDat;
+         psVar->siCnt=0;
+         psVar->siLen=0;
+         psVar->siInd=0;
+         psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
+         if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psVar->siRst*=psHlp->psFix->siMax; }
+      }
    }
 
    TRACE(psHdl->pfBld,"%s BUILD-BEGIN-OBJECT-%s(PTR=%p CNT=%d LEN=%d RST=%d)\n",
-                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst);
+                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst);
 
    *ppDep=psArg->psDep;
    return(psArg->psFix->siTyp);
@@ -7547,7 +9914,7 @@ static int siClpFinObj(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym*                        psDep,
-   const TsVar                   asSav[])
+   const int                     siSav)
 {
    const int                     siTyp=CLPTYP_OBJECT;
    TsSym*                        psHlp;
@@ -7571,16 +9938,16 @@ static int siClpFinObj(
 
    if (psHdl->isChk) {
       for (psHlp=psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
-         if (psHlp->psVar->siCnt<psHlp->psFix->siMin) {
+         if (GETVAR(psHdl,psHlp)->siCnt<psHlp->psFix->siMin) {
             if (psHlp->psFix->siMin<=1) {
                CLPERR(psHdl,CLPERR_SEM,"Parameter '%s.%s.%s' not specified",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psHlp->psStd->pcKyw);
                CLPERRADD(psHdl,0,"Please specify parameter:%s","");
-               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                            CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
             } else {
-               CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s.%s' is smaller than required minimum amount (%d)",psDep->psVar->siCnt,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psHlp->psStd->pcKyw,psHlp->psFix->siMin);
+               CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s.%s' is smaller than required minimum amount (%d)",GETVAR(psHdl,psDep)->siCnt,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psHlp->psStd->pcKyw,psHlp->psFix->siMin);
                CLPERRADD(psHdl,0,"Please specify parameter additionally %d times:%s","");
-               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+               vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                            CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
             }
             return(CLPERR_SEM);
@@ -7588,24 +9955,28 @@ static int siClpFinObj(
       }
    }
 
-   for (psHlp=psDep;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) { psHlp->psVar[0]=asSav[0]; }
+   const TsVar* psSav=psHdl->psSav+siSav;
+   for (psHlp=psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (!CLPISF_ALI(psHlp->psStd->uiFlg)) { psHdl->psVar[psHlp->siVar]=*psSav++; }
+   }
+   psHdl->siSav=siSav;
 
-   psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-   psArg->psVar->siLen+=psArg->psFix->siSiz;
-   psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-   psArg->psVar->siCnt++;
+   GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siCnt++;
 
    TRACE(psHdl->pfBld,"%s BUILD-END-OBJECT-%s(PTR=%p CNT=%d LEN=%d RST=%d)\n",
-                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst);
+                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst);
 
    pcPat=fpcPat(psHdl,siLev);
-   srprintc(&psHdl->pcLst,&psHdl->szLst,strlen(pcPat)+strlen(GETKYW(psArg)),"%s.%s)\n",pcPat,GETKYW(psArg));
+   srprintl(&psHdl->pcLst,&psHdl->szLst,&psHdl->siLst,strlen(pcPat)+strlen(GETKYW(psArg)),"%s.%s)\n",pcPat,GETKYW(psArg));
 
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siCnt,psArg->psFix->psCnt,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siCnt,psArg->psFix->psCnt,FALSE);
    if (siErr<0) { return(siErr); }
    siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siSiz,psArg->psFix->psEln,TRUE);
    if (siErr<0) { return(siErr); }
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psTln,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psTln,FALSE);
    if (siErr<0) { return(siErr); }
    if(psArg->psFix->siOid){
       siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siOid,psArg->psFix->psOid,TRUE);
@@ -7620,18 +9991,18 @@ static int siClpIniOvl(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym**                       ppDep,
-   TsVar                         asSav[])
+   int*                          piSav)
 {
    int                           siErr;
    const int                     siTyp=CLPTYP_OVRLAY;
    const char*                   pcPat=fpcPat(psHdl,siLev);
-   TsSym*                        psHlp;
+   const TsSym*                  psHlp;
    (void)siPos;
 
    if (psArg->psFix->siTyp!=siTyp) {
       return CLPERR(psHdl,CLPERR_SEM,"The type (%s) of argument '%s.%s' don't match the expected type (%s)",pcMapClpTyp(siTyp),pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
-   if (psArg->psVar->siCnt>=psArg->psFix->siMax) {
+   if (GETVAR(psHdl,psArg)->siCnt>=psArg->psFix->siMax) {
       return CLPERR(psHdl,CLPERR_SEM,"Too many (>%d) occurrences of '%s.%s' with type '%s'",psArg->psFix->siMax,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(psArg->psFix->siTyp));
    }
 
@@ -7644,15 +10015,15 @@ static int siClpIniOvl(
    }
 
    if (CLPISF_DYN(psArg->psStd->uiFlg)) {
-      void** ppDat=(void**)psArg->psVar->pvDat;
-      (*ppDat)=pvClpAllocFlg(psHdl,(*ppDat),psArg->psVar->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)),&psArg->psVar->siInd,psArg->psStd->uiFlg);
+      void** ppDat=(void**)GETVAR(psHdl,psArg)->pvDat;
+      (*ppDat)=pvClpAllocDat(psHdl,psArg,ppDat,GETVAR(psHdl,psArg)->siLen+((((CLPISF_DLM(psArg->psStd->uiFlg))?2:1)*psArg->psFix->siSiz)));
       if ((*ppDat)==NULL) {
-         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d) for overlay '%s.%s' failed",psArg->psVar->siLen,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
+         return CLPERR(psHdl,CLPERR_MEM,"Dynamic memory allocation (%d+%d) for overlay '%s.%s' failed",GETVAR(psHdl,psArg)->siLen,psArg->psFix->siSiz,pcPat,psArg->psStd->pcKyw);
       }
-      psArg->psVar->pvPtr=((char*)(*ppDat))+psArg->psVar->siLen;
+      GETVAR(psHdl,psArg)->pvPtr=((char*)(*ppDat))+GETVAR(psHdl,psArg)->siLen;
    } else {
-      if (psArg->psVar->siRst<psArg->psFix->siSiz) {
-         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",psArg->psVar->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
+      if (GETVAR(psHdl,psArg)->siRst<psArg->psFix->siSiz) {
+         return CLPERR(psHdl,CLPERR_SIZ,"Rest of space (%d) is not big enough for argument '%s.%s' with type '%s'",GETVAR(psHdl,psArg)->siRst,pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
       }
    }
 
@@ -7662,18 +10033,25 @@ static int siClpIniOvl(
       return CLPERR(psHdl,CLPERR_TAB,"Keyword (%s.%s) and type (%s) of argument defined but pointer to parameter table not set (3)",pcPat,psArg->psStd->pcKyw,pcMapClpTyp(siTyp));
    }
 
-   for (psHlp=psArg->psDep;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) {
-      asSav[0]=psHlp->psVar[0];
-      psHlp->psVar->pvDat=(char*)psArg->psVar->pvPtr;
-      psHlp->psVar->pvPtr=psHlp->psVar->pvDat;
-      psHlp->psVar->siCnt=0;
-      psHlp->psVar->siLen=0;
-      psHlp->psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
-      if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psHlp->psVar->siRst*=psHlp->psFix->siMax; }
+   TsVar*       psSav=psClpSavPsh(psHdl,psArg->psDep->psIdx->siEnt,piSav);
+   if (psSav==NULL) {
+      return CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to save values of parameter table '%s' failed",fpcPat(psHdl,siLev));
+   }
+   for (psHlp=psArg->psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (!CLPISF_ALI(psHlp->psStd->uiFlg)) {
+         TsVar* psVar=psHdl->psVar+psHlp->siVar;
+         *psSav++=psVar[0];
+         psVar->pvDat=(char*)GETVAR(psHdl,psArg)->pvPtr;
+         psVar->pvPtr=psVar->pvDat;
+         psVar->siCnt=0;
+         psVar->siLen=0;
+         psVar->siRst=CLPISF_DYN(psHlp->psStd->uiFlg)?0:psHlp->psFix->siSiz;
+         if (CLPISF_FIX(psHlp->psStd->uiFlg)) { psVar->siRst*=psHlp->psFix->siMax; }
+      }
    }
 
    TRACE(psHdl->pfBld,"%s BUILD-BEGIN-OVERLAY-%s(PTR=%p CNT=%d LEN=%d RST=%d)\n",
-                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst);
+                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst);
 
    *ppDep=psArg->psDep;
    return(psArg->psFix->siTyp);
@@ -7685,7 +10063,7 @@ static int siClpFinOvl(
    const int                     siPos,
    TsSym*                        psArg,
    TsSym*                        psDep,
-   const TsVar                   asSav[],
+   const int                     siSav,
    const int                     siOid)
 {
    const int                     siTyp=CLPTYP_OVRLAY;
@@ -7712,16 +10090,16 @@ static int siClpFinOvl(
    if (psHdl->isChk) {
       for (psHlp=psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
          if (psHlp->psFix->siOid==siOid) {
-            if (psHlp->psVar->siCnt<psHlp->psFix->siMin) {
+            if (GETVAR(psHdl,psHlp)->siCnt<psHlp->psFix->siMin) {
                if (psHlp->psFix->siMin<=1) {
                   CLPERR(psHdl,CLPERR_SEM,"Parameter '%s.%s.%s' not specified",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psHlp->psStd->pcKyw);
                   CLPERRADD(psHdl,0,"Please specify parameter:%s","");
-                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                               CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
                } else {
-                  CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s.%s' is smaller than required minimum amount (%d)",psDep->psVar->siCnt,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psHlp->psStd->pcKyw,psHlp->psFix->siMin);
+                  CLPERR(psHdl,CLPERR_SEM,"Amount of occurrences (%d) of parameter '%s.%s.%s' is smaller than required minimum amount (%d)",GETVAR(psHdl,psDep)->siCnt,fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psHlp->psStd->pcKyw,psHlp->psFix->siMin);
                   CLPERRADD(psHdl,0,"Please specify parameter additionally %d times:%s","");
-                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+                  vdClpPrnArg(psHdl,psHdl->pfErr,1,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                               CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
                }
                return(CLPERR_SEM);
@@ -7730,21 +10108,25 @@ static int siClpFinOvl(
       }
    }
 
-   for (psHlp=psDep;psHlp!=NULL;psHlp=psHlp->psNxt,asSav++) { psHlp->psVar[0]=asSav[0]; }
+   const TsVar* psSav=psHdl->psSav+siSav;
+   for (psHlp=psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
+      if (!CLPISF_ALI(psHlp->psStd->uiFlg)) { psHdl->psVar[psHlp->siVar]=*psSav++; }
+   }
+   psHdl->siSav=siSav;
 
-   psArg->psVar->pvPtr=((char*)psArg->psVar->pvPtr)+psArg->psFix->siSiz;
-   psArg->psVar->siLen+=psArg->psFix->siSiz;
-   psArg->psVar->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
-   psArg->psVar->siCnt++;
+   GETVAR(psHdl,psArg)->pvPtr=((char*)GETVAR(psHdl,psArg)->pvPtr)+psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siLen+=psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siRst-=CLPISF_DYN(psArg->psStd->uiFlg)?0:psArg->psFix->siSiz;
+   GETVAR(psHdl,psArg)->siCnt++;
 
    TRACE(psHdl->pfBld,"%s BUILD-END-OVERLAY-%s(PTR=%p CNT=%d LEN=%d RST=%d)\n",
-                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,psArg->psVar->pvPtr,psArg->psVar->siCnt,psArg->psVar->siLen,psArg->psVar->siRst);
+                           fpcPre(psHdl,siLev),psArg->psStd->pcKyw,GETVAR(psHdl,psArg)->pvPtr,GETVAR(psHdl,psArg)->siCnt,GETVAR(psHdl,psArg)->siLen,GETVAR(psHdl,psArg)->siRst);
 
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siCnt,psArg->psFix->psCnt,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siCnt,psArg->psFix->psCnt,FALSE);
    if (siErr<0) { return(siErr); }
    siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psFix->siSiz,psArg->psFix->psEln,TRUE);
    if (siErr<0) { return(siErr); }
-   siErr=siClpBldLnk(psHdl,siLev,siPos,psArg->psVar->siLen,psArg->psFix->psTln,FALSE);
+   siErr=siClpBldLnk(psHdl,siLev,siPos,GETVAR(psHdl,psArg)->siLen,psArg->psFix->psTln,FALSE);
    if (siErr<0) { return(siErr); }
    if(siOid){
       siErr=siClpBldLnk(psHdl,siLev,siPos,siOid,psArg->psFix->psOid,TRUE);
@@ -7755,6 +10137,88 @@ static int siClpFinOvl(
 
 /**********************************************************************/
 
+static int siClpDfcAdd(
+   TsHdl*                        psHdl,
+   TsDfc*                        psDfc,
+   const char*                   pcDft,
+   const char*                   pcVal)
+{
+   const char*                   pcEnd=pcDft+strlen(pcDft);
+   size_t                        l=strlen(pcVal)+1;
+   TsDfv*                        psVal;
+   if (pcVal[0]=='f' || psHdl->pcRow<pcDft || psHdl->pcOld<pcDft || psHdl->pcCur<pcDft ||
+       psHdl->pcRow>pcEnd || psHdl->pcOld>pcEnd || psHdl->pcCur>pcEnd) {
+      return(-1);
+   }
+   if (psDfc->siVal>=psDfc->szVal) {
+      int szVal=(psDfc->szVal)?psDfc->szVal*2:4;
+      psVal=(TsDfv*)realloc_nowarn(psDfc->psVal,sizeof(TsDfv)*szVal);
+      if (psVal==NULL) return(-1);
+      psDfc->psVal=psVal;
+      psDfc->szVal=szVal;
+   }
+   if (psDfc->siBuf+l>psDfc->szBuf) {
+      size_t szBuf=(psDfc->siBuf+l>2*psDfc->szBuf)?psDfc->siBuf+l:2*psDfc->szBuf;
+      char*  pcBuf=(char*)realloc_nowarn(psDfc->pcBuf,szBuf);
+      if (pcBuf==NULL) return(-1);
+      psDfc->pcBuf=pcBuf;
+      psDfc->szBuf=szBuf;
+   }
+   psVal=psDfc->psVal+psDfc->siVal;
+   psVal->siOfs=psDfc->siBuf;
+   psVal->siRow=psHdl->siRow;
+   psVal->siRwo=(int)(psHdl->pcRow-pcDft);
+   psVal->siOld=(int)(psHdl->pcOld-pcDft);
+   psVal->siCur=(int)(psHdl->pcCur-pcDft);
+   memcpy(psDfc->pcBuf+psDfc->siBuf,pcVal,l);
+   psDfc->siBuf+=l;
+   psDfc->siVal++;
+   return(CLP_OK);
+}
+
+static int siClpDfcRun(
+   TsHdl*                        psHdl,
+   const int                     siLev,
+   const int                     siPos,
+   TsSym*                        psArg,
+   const TsDfc*                  psDfc)
+{
+   const TsPro*                  psPro=GETPRO(psHdl,psArg);
+   char*                         pcSrc=psHdl->pcSrc;
+   const char*                   pcInp=psHdl->pcInp;
+   const char*                   pcCur=psHdl->pcCur;
+   const char*                   pcOld=psHdl->pcOld;
+   const char*                   pcRow=psHdl->pcRow;
+   const int                     siRow=psHdl->siRow;
+   const size_t                  szInp=psHdl->szInp;
+   int                           siErr=CLP_OK;
+   int                           i;
+   TRACE(psHdl->pfPrs,"SUPPLEMENT-LIST-REPLAY-BEGIN(%s.%s=%s)\n",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psPro->pcDft);
+   psHdl->pcSrc=psPro->pcSrc; // only referenced for error messages (no string files in compiled defaults)
+   psHdl->pcInp=psPro->pcDft;
+   psHdl->szInp=0;
+   psHdl->siBuf++;
+   for (i=0;i<psDfc->siVal && siErr>=0;i++) {
+      const TsDfv*               psVal=psDfc->psVal+i;
+      char*                      pcVal=psDfc->pcBuf+psVal->siOfs;
+      psHdl->pcRow=psHdl->pcInp+psVal->siRwo;
+      psHdl->pcOld=psHdl->pcInp+psVal->siOld;
+      psHdl->pcCur=psHdl->pcInp+psVal->siCur;
+      psHdl->siRow=psVal->siRow;
+      TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d LIT(%s))\n",fpcPre(psHdl,siLev),siLev,siPos,isPrnLex(psArg,pcVal));
+      siErr=siClpBldLit(psHdl,siLev,siPos,psArg,pcVal);
+   }
+   psHdl->pcSrc=pcSrc;
+   if (siErr<0) { // keep the position in the default for the error like the parser
+      srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(psPro->pcSrc),"%s",psPro->pcSrc);
+      return(siErr);
+   }
+   psHdl->siBuf--;
+   psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow; psHdl->szInp=szInp;
+   TRACE(psHdl->pfPrs,"SUPPLEMENT-LIST-REPLAY-END(%s.%s=%s)\n",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psPro->pcDft);
+   return(CLP_OK);
+}
+
 static int siClpSetDefault(
    TsHdl*                        psHdl,
    const int                     siLev,
@@ -7763,26 +10227,47 @@ static int siClpSetDefault(
 {
    TsSym*                        psDep=NULL;
    TsSym*                        psVal=NULL;
+   TsDfc*                        psDfc=NULL;
+   const unsigned int            uiDyn=psHdl->uiDyn;
    size_t                        szVal=CLPINI_VALSIZ;
-   char*                         pcVal=(char*)calloc(1,szVal);
+   char*                         pcVal;
    const char*                   pcCur;
    const char*                   pcInp;
    const char*                   pcOld;
    const char*                   pcRow;
+   size_t                        szInp;
+   if (CLPISF_ARG(psArg->psStd->uiFlg) && GETVAR(psHdl,psArg)->siCnt==0 && GETPRO(psHdl,psArg)->pcDft!=NULL &&
+       (psArg->psFix->siTyp==CLPTYP_NUMBER || psArg->psFix->siTyp==CLPTYP_FLOATN || psArg->psFix->siTyp==CLPTYP_STRING)) {
+      psDfc=psHdl->psDfc+psArg->siVar;
+      if (psDfc->pcDft!=GETPRO(psHdl,psArg)->pcDft) {
+         vdClpDfcRst(psHdl,psArg);
+      } else if (psDfc->isDyn) {
+         psDfc=NULL;
+      } else {
+         int siErr=siExtentConTab(psHdl,siLev,psArg);
+         if (siErr<0) { return(siErr); }
+         return(siClpDfcRun(psHdl,siLev,siPos,psArg,psDfc));
+      }
+   }
+   pcVal=(char*)calloc(1,szVal);
    if (pcVal==NULL) { return(CLPERR(psHdl,CLPERR_MEM,"Allocation of memory to store the value expression failed")); }
-   if (CLPISF_ARG(psArg->psStd->uiFlg) && psArg->psVar->siCnt==0 && psArg->psFix->pcDft!=NULL && strlen(psArg->psFix->pcDft)) {
+   if (CLPISF_ARG(psArg->psStd->uiFlg) && GETVAR(psHdl,psArg)->siCnt==0 && GETPRO(psHdl,psArg)->pcDft!=NULL && strlen(GETPRO(psHdl,psArg)->pcDft)) {
       int   siRow,siTok,siErr;
+      int   isCmp=TRUE;
       char  acSrc[strlen(psHdl->pcSrc)+1];
       char  acLex[strlen(psHdl->pcLex)+1];
-      TRACE(psHdl->pfPrs,"SUPPLEMENT-LIST-PARSER-BEGIN(%s.%s=%s)\n",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psArg->psFix->pcDft);
+      TRACE(psHdl->pfPrs,"SUPPLEMENT-LIST-PARSER-BEGIN(%s.%s=%s)\n",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,GETPRO(psHdl,psArg)->pcDft);
+      siErr=siExtentConTab(psHdl,siLev,psArg);
+      if (siErr<0) { free(pcVal); return(siErr); }
       strcpy(acSrc,psHdl->pcSrc);
       strcpy(acLex,psHdl->pcLex);
-      srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(psArg->psFix->pcSrc),"%s",psArg->psFix->pcSrc);
-      pcInp=psHdl->pcInp; psHdl->pcInp=psArg->psFix->pcDft;
+      srprintf(&psHdl->pcSrc,&psHdl->szSrc,strlen(GETPRO(psHdl,psArg)->pcSrc),"%s",GETPRO(psHdl,psArg)->pcSrc);
+      pcInp=psHdl->pcInp; psHdl->pcInp=GETPRO(psHdl,psArg)->pcDft;
       pcCur=psHdl->pcCur; psHdl->pcCur=psHdl->pcInp;
       pcOld=psHdl->pcOld; psHdl->pcOld=psHdl->pcInp;
       pcRow=psHdl->pcRow; psHdl->pcRow=psHdl->pcInp;
-      siRow=psHdl->siRow; psHdl->siRow=psArg->psFix->siRow;
+      siRow=psHdl->siRow; psHdl->siRow=GETPRO(psHdl,psArg)->siRow;
+      szInp=psHdl->szInp; psHdl->szInp=0;
       siTok=psHdl->siTok;
       psHdl->siBuf++;
 
@@ -7790,23 +10275,23 @@ static int siClpSetDefault(
            psHdl->siTok=siClpScnSrc(psHdl,psArg->psFix->siTyp,psArg)) {
          if (psHdl->siTok==CLPTOK_KYW) {
             if (psArg->psFix->siTyp==CLPTYP_OBJECT) {
-               TsVar asSav[CLPMAX_TABCNT];
+               int siSav=0;
                if (strxcmp(psHdl->isCas,psHdl->pcLex,"INIT",0,0,FALSE)!=0) {
                   siErr=CLPERR(psHdl,CLPERR_SYN,"Keyword (%s) in default / property definition for object '%s.%s' is not 'INIT'",psHdl->pcLex,fpcPat(psHdl,siLev),psArg->psStd->pcKyw);
                   free(pcVal);
                   return(siErr);
                }
-               siErr=siClpIniObj(psHdl,siLev,siPos,psArg,&psDep,asSav);
+               siErr=siClpIniObj(psHdl,siLev,siPos,psArg,&psDep,&siSav);
                if (siErr<0) { free(pcVal); return(siErr); }
-               siErr=siClpFinObj(psHdl,siLev,siPos,psArg,psDep,asSav);
+               siErr=siClpFinObj(psHdl,siLev,siPos,psArg,psDep,siSav);
                if (siErr<0) { free(pcVal); return(siErr); }
             } else  if (psArg->psFix->siTyp==CLPTYP_OVRLAY) {
-               TsVar asSav[CLPMAX_TABCNT];
-               siErr=siClpIniOvl(psHdl,siLev,siPos,psArg,&psDep,asSav);
+               int siSav=0;
+               siErr=siClpIniOvl(psHdl,siLev,siPos,psArg,&psDep,&siSav);
                if (siErr<0) { free(pcVal); return(siErr); }
                siErr=siClpSymFnd(psHdl,siLev+1,psHdl->pcLex,psDep,&psVal,NULL);
                if (siErr<0) { free(pcVal); return(siErr); }
-               siErr=siClpFinOvl(psHdl,siLev,siPos,psArg,psDep,asSav,psVal->psFix->siOid);
+               siErr=siClpFinOvl(psHdl,siLev,siPos,psArg,psDep,siSav,psVal->psFix->siOid);
                if (siErr<0) { free(pcVal); return(siErr); }
             } else if (psArg->psFix->siTyp==CLPTYP_SWITCH) {
                   if (strxcmp(psHdl->isCas,psHdl->pcLex,"ON",0,0,FALSE)!=0 && strxcmp(psHdl->isCas,psHdl->pcLex,"OFF",0,0,FALSE)!=0) {
@@ -7822,6 +10307,7 @@ static int siClpSetDefault(
                siErr=siClpPrsExp(psHdl,siLev,siPos,FALSE,psArg,&szVal,&pcVal);
                if (siErr<0) { free(pcVal); return(siErr); }
                TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d LIT(%s))\n",fpcPre(psHdl,siLev),siLev,siPos,isPrnLex(psArg,pcVal));
+               if (psDfc!=NULL && siClpDfcAdd(psHdl,psDfc,GETPRO(psHdl,psArg)->pcDft,pcVal)<0) { isCmp=FALSE; }
                siErr=siClpBldLit(psHdl,siLev,siPos,psArg,pcVal);
                if (siErr<0) { free(pcVal); return(siErr); }
             }
@@ -7829,6 +10315,7 @@ static int siClpSetDefault(
             siErr=siClpPrsExp(psHdl,siLev,siPos,FALSE,psArg,&szVal,&pcVal);
             if (siErr<0) { free(pcVal); return(siErr); }
             TRACE(psHdl->pfPrs,"%s PARSER(LEV=%d POS=%d LIT(%s))\n",fpcPre(psHdl,siLev),siLev,siPos,isPrnLex(psArg,pcVal));
+            if (psDfc!=NULL && siClpDfcAdd(psHdl,psDfc,GETPRO(psHdl,psArg)->pcDft,pcVal)<0) { isCmp=FALSE; }
             siErr=siClpBldLit(psHdl,siLev,siPos,psArg,pcVal);
             if (siErr<0) { free(pcVal); return(siErr); }
          }
@@ -7838,8 +10325,12 @@ static int siClpSetDefault(
       psHdl->siTok=siTok;
       strcpy(psHdl->pcLex,acLex);
       strcpy(psHdl->pcSrc,acSrc);
-      psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow;
-      TRACE(psHdl->pfPrs,"SUPPLEMENT-LIST-PARSER-END(%s.%s=%s)\n",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,psArg->psFix->pcDft);
+      psHdl->pcInp=pcInp; psHdl->pcCur=pcCur; psHdl->pcOld=pcOld; psHdl->pcRow=pcRow; psHdl->siRow=siRow; psHdl->szInp=szInp;
+      if (psDfc!=NULL) {
+         psDfc->isDyn=(!isCmp || psHdl->uiDyn!=uiDyn);
+         psDfc->pcDft=GETPRO(psHdl,psArg)->pcDft;
+      }
+      TRACE(psHdl->pfPrs,"SUPPLEMENT-LIST-PARSER-END(%s.%s=%s)\n",fpcPat(psHdl,siLev),psArg->psStd->pcKyw,GETPRO(psHdl,psArg)->pcDft);
    }
    free(pcVal);
    return(CLP_OK);
@@ -7922,7 +10413,7 @@ static void vdClpPrnArgTab(
    }
    for (psHlp=psTab;psHlp!=NULL && psHlp->psStd!=NULL;psHlp=psHlp->psNxt) {
       if ((psHlp->psFix->siTyp==siTyp || siTyp<0) && !CLPISF_LNK(psHlp->psStd->uiFlg) && !CLPISF_HID(psHlp->psStd->uiFlg)) {
-         vdClpPrnArg(psHdl,pfOut,siLev,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+         vdClpPrnArg(psHdl,pfOut,siLev,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                      CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
       }
    }
@@ -8036,6 +10527,8 @@ static int siClpPrnCmd(
                   }
                }
                k++;
+               siErr=siExtentConTab(psHdl,siLev,psHlp);
+               if (siErr<0) { return(siErr); }
                switch (psHlp->psFix->siTyp) {
                case CLPTYP_SWITCH:
                   if (psHlp->psFix->siMax==1) {
@@ -8272,7 +10765,7 @@ static int siClpPrnHlp(
          for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
             if ((psHlp->psFix->siTyp==siTyp || siTyp<0) && CLPISF_CMD(psHlp->psStd->uiFlg) && !CLPISF_LNK(psHlp->psStd->uiFlg) && !CLPISF_HID(psHlp->psStd->uiFlg)) {
                if (!CLPISF_ALI(psHlp->psStd->uiFlg) || (CLPISF_ALI(psHlp->psStd->uiFlg) && isAli)) {
-                  vdClpPrnArg(psHdl,pfOut,siLev,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,psHlp->psFix->pcDft,
+                  vdClpPrnArg(psHdl,pfOut,siLev,psHlp->psStd->pcKyw,GETALI(psHlp),psHlp->psStd->siKwl,psHlp->psFix->siTyp,psHlp->psFix->pcHlp,GETPRO(psHdl,psHlp)->pcDft,
                               CLPISF_SEL(psHlp->psStd->uiFlg),CLPISF_CON(psHlp->psStd->uiFlg));
                   if (psHlp->psFix->siTyp==CLPTYP_NUMBER && CLPISF_DEF(psHlp->psStd->uiFlg)) {
                      fprintf(pfOut,"%s If you type the keyword without an assignment of a value, the default (%d) is used\n",fpcPre(psHdl,siLev+1),psHlp->psFix->siOid);
@@ -8318,7 +10811,8 @@ static int siClpPrnSyn(
    }
 
    if (pfOut!=NULL) {
-      int siErr;
+      int siErr=siExtentConTab(psHdl,siLev,psArg);
+      if (siErr<0) { return(siErr); }
       if (isPat) {
          fprintf(pfOut,"%s.",fpcPat(psHdl,siLev));
       }
@@ -8504,8 +10998,8 @@ static int siClpPrnDoc(
       int                           k,m;
       int                           siMan=0;
       int                           siLst=0;
-      const TsSym*                  apMan[CLPMAX_TABCNT];
-      const TsSym*                  apLst[CLPMAX_TABCNT];
+      const TsSym*                  apMan[psTab->psIdx->siEnt];
+      const TsSym*                  apLst[psTab->psIdx->siEnt];
       if (psTab->psBak!=NULL) {
          return CLPERR(psHdl,CLPERR_INT,"Entry '%s.%s' not at beginning of a table (8)",fpcPat(psHdl,siLev),psTab->psStd->pcKyw);
       }
@@ -8515,6 +11009,8 @@ static int siClpPrnDoc(
                apMan[siMan]=psHlp;
                siMan++;
             } else {
+               int siErr=siExtentConTab(psHdl,siLev,psHlp);
+               if (siErr<0) { return(siErr); }
                for (psSel=psHlp->psDep;psSel!=NULL;psSel=psSel->psNxt) {
                   if (psSel->psFix->pcMan!=NULL && *psSel->psFix->pcMan) {
                      apMan[siMan]=psHlp;
@@ -8674,6 +11170,8 @@ static int siClpWriteArgument(
          return CLPERR(psHdl,CLPERR_TAB,"Manual page for constant '%s.%s' missing",pcPat,psArg->psStd->pcKyw);
       }
       int i=0;
+      int siErr=siExtentConTab(psHdl,siLev,psArg);
+      if (siErr<0) { return(siErr); }
       for (const TsSym* psHlp=psArg->psDep;psHlp!=NULL;psHlp=psHlp->psNxt) {
          if (psArg->psFix->siTyp==psHlp->psFix->siTyp && psHlp->psFix->pcMan==NULL && !CLPISF_HID(psHlp->psStd->uiFlg)) {
             if (i==0) { fprintf(pfDoc,".Selections\n\n"); }
@@ -8822,7 +11320,7 @@ static int siClpPrnPro(
       if (siLev<siDep || siDep>9) {
          for (psHlp=psTab;psHlp!=NULL;psHlp=psHlp->psNxt) {
             if (CLPISF_ARG(psHlp->psStd->uiFlg) && CLPISF_PRO(psHlp->psStd->uiFlg) && (pcArg==NULL || strxcmp(psHdl->isCas,psHlp->psStd->pcKyw,pcArg,0,0,FALSE)==0) && !CLPISF_HID(psHlp->psStd->uiFlg)) {
-               if (psHlp->psFix->pcDft!=NULL && *psHlp->psFix->pcDft) {
+               if (GETPRO(psHdl,psHlp)->pcDft!=NULL && *GETPRO(psHdl,psHlp)->pcDft) {
                   if ((isMan || (!CLPISF_CMD(psHlp->psStd->uiFlg))) && psHlp->psFix->pcMan!=NULL && *psHlp->psFix->pcMan) {
                      if (siMtd==CLPPRO_MTD_DOC) {
                         fprintf(pfOut,".DESCRIPTION FOR %s.%s.%s.%s: (TYPE: %s) %s\n\n",psHdl->pcOwn,psHdl->pcPgm,fpcPat(psHdl,siLev),psHlp->psStd->pcKyw,pcMapClpTyp(psHlp->psFix->siTyp),psHlp->psFix->pcHlp);
@@ -8843,7 +11341,7 @@ static int siClpPrnPro(
                         fprintf(pfOut,".HELP FOR %s.%s.%s.%s: (TYPE: %s) %s\n\n",psHdl->pcOwn,psHdl->pcPgm,fpcPat(psHdl,siLev),psHlp->psStd->pcKyw,pcMapClpTyp(psHlp->psFix->siTyp),psHlp->psFix->pcHlp);
                      }
                   } else {
-                     fprintf(pfOut," %s.%s.%s.%s=\"%s\" ",psHdl->pcOwn,psHdl->pcPgm,fpcPat(psHdl,siLev),psHlp->psStd->pcKyw,psHlp->psFix->pcDft);
+                     fprintf(pfOut," %s.%s.%s.%s=\"%s\" ",psHdl->pcOwn,psHdl->pcPgm,fpcPat(psHdl,siLev),psHlp->psStd->pcKyw,GETPRO(psHdl,psHlp)->pcDft);
                      efprintf(pfOut,"# TYPE: %s HELP: %s #\n",pcMapClpTyp(psHlp->psFix->siTyp),psHlp->psFix->pcHlp);
                   }
                } else {